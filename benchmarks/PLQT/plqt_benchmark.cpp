@@ -0,0 +1,231 @@
+#include <benchmark/benchmark.h>
+#include "PLQT/plqt.h"
+#include "../allocation_counter.h"
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// Compares the PLQT against two alternative visited-set structures on the
+// kind of trajectory a tabu search produces: each configuration differs from
+// the previous one in exactly one facility, so configurations are revisited.
+
+namespace
+{
+    const int kTrajectoryLength = 4096;
+
+    std::vector<std::vector<int>> makeTrajectory(int dimension, int length)
+    {
+        std::mt19937 gen(12345 + dimension);
+        std::uniform_int_distribution<int> facility(0, dimension - 1);
+        std::bernoulli_distribution open(0.5);
+
+        std::vector<int> y(dimension);
+        for (int &value : y)
+        {
+            value = open(gen) ? 1 : 0;
+        }
+
+        std::vector<std::vector<int>> trajectory;
+        trajectory.reserve(length);
+        trajectory.push_back(y);
+        for (int step = 1; step < length; ++step)
+        {
+            y[facility(gen)] ^= 1;
+            trajectory.push_back(y);
+        }
+        return trajectory;
+    }
+
+    // Probes alternate a visited configuration and a one-flip neighbour of it.
+    std::vector<std::vector<int>> makeProbes(const std::vector<std::vector<int>> &trajectory)
+    {
+        std::mt19937 gen(54321);
+        std::uniform_int_distribution<int> facility(0, static_cast<int>(trajectory[0].size()) - 1);
+
+        std::vector<std::vector<int>> probes;
+        probes.reserve(trajectory.size() * 2);
+        for (const auto &y : trajectory)
+        {
+            probes.push_back(y);
+            std::vector<int> neighbour = y;
+            neighbour[facility(gen)] ^= 1;
+            probes.push_back(neighbour);
+        }
+        return probes;
+    }
+
+    void packInto(const std::vector<int> &y, uint64_t *words, size_t wordCount)
+    {
+        std::fill(words, words + wordCount, 0);
+        for (size_t i = 0; i < y.size(); ++i)
+        {
+            words[i / 64] |= static_cast<uint64_t>(y[i] & 1) << (i % 64);
+        }
+    }
+
+    class PlqtSet
+    {
+    public:
+        explicit PlqtSet(int dimension) : tree_(dimension, nullptr) {}
+        void insert(const std::vector<int> &y) { tree_.insert(y); }
+        bool contains(const std::vector<int> &y) const { return tree_.search(y) != nullptr; }
+
+    private:
+        PLQT tree_;
+    };
+
+    class HashedSet
+    {
+    public:
+        explicit HashedSet(int dimension)
+            : words_((dimension + 63) / 64), buffer_(words_), key_(words_ * sizeof(uint64_t), '\0') {}
+
+        void insert(const std::vector<int> &y) { set_.insert(pack(y)); }
+        bool contains(const std::vector<int> &y) { return set_.count(pack(y)) != 0; }
+
+    private:
+        size_t words_;
+        std::vector<uint64_t> buffer_;
+        std::string key_;
+        std::unordered_set<std::string> set_;
+
+        const std::string &pack(const std::vector<int> &y)
+        {
+            packInto(y, buffer_.data(), words_);
+            std::memcpy(&key_[0], buffer_.data(), key_.size());
+            return key_;
+        }
+    };
+
+    class SortedBitsetSet
+    {
+    public:
+        explicit SortedBitsetSet(int dimension) : words_((dimension + 63) / 64), probe_(words_) {}
+
+        void insert(const std::vector<int> &y)
+        {
+            packInto(y, probe_.data(), words_);
+            size_t position = lowerBound();
+            if (position < count_ && equalsAt(position))
+            {
+                return;
+            }
+            keys_.insert(keys_.begin() + position * words_, probe_.begin(), probe_.end());
+            ++count_;
+        }
+
+        bool contains(const std::vector<int> &y)
+        {
+            packInto(y, probe_.data(), words_);
+            size_t position = lowerBound();
+            return position < count_ && equalsAt(position);
+        }
+
+    private:
+        size_t words_;
+        size_t count_ = 0;
+        std::vector<uint64_t> keys_;  ///< count_ keys of words_ words, sorted
+        std::vector<uint64_t> probe_;
+
+        bool lessAt(size_t position) const
+        {
+            return std::lexicographical_compare(keys_.begin() + position * words_,
+                                                keys_.begin() + (position + 1) * words_,
+                                                probe_.begin(), probe_.end());
+        }
+
+        bool equalsAt(size_t position) const
+        {
+            return std::equal(probe_.begin(), probe_.end(), keys_.begin() + position * words_);
+        }
+
+        size_t lowerBound() const
+        {
+            size_t low = 0, high = count_;
+            while (low < high)
+            {
+                size_t mid = (low + high) / 2;
+                if (lessAt(mid))
+                    low = mid + 1;
+                else
+                    high = mid;
+            }
+            return low;
+        }
+    };
+
+    template <typename Set>
+    void BM_Insert(benchmark::State &state)
+    {
+        int dimension = static_cast<int>(state.range(0));
+        auto trajectory = makeTrajectory(dimension, kTrajectoryLength);
+
+        int64_t bytes = 0;
+        for (auto _ : state)
+        {
+            AllocationStats before = currentAllocationStats();
+            Set set(dimension);
+            for (const auto &y : trajectory)
+            {
+                set.insert(y);
+            }
+            bytes = currentAllocationStats().liveBytes - before.liveBytes;
+            benchmark::DoNotOptimize(set);
+        }
+
+        std::vector<std::vector<int>> distinct = trajectory;
+        std::sort(distinct.begin(), distinct.end());
+        distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(trajectory.size()));
+        state.counters["distinct"] = static_cast<double>(distinct.size());
+        state.counters["bytes_per_element"] = static_cast<double>(bytes) / distinct.size();
+    }
+
+    template <typename Set>
+    void BM_Search(benchmark::State &state)
+    {
+        int dimension = static_cast<int>(state.range(0));
+        auto trajectory = makeTrajectory(dimension, kTrajectoryLength);
+        auto probes = makeProbes(trajectory);
+
+        Set set(dimension);
+        for (const auto &y : trajectory)
+        {
+            set.insert(y);
+        }
+
+        int64_t hits = 0;
+        for (auto _ : state)
+        {
+            for (const auto &y : probes)
+            {
+                hits += set.contains(y) ? 1 : 0;
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(probes.size()));
+        state.counters["hit_ratio"] = static_cast<double>(hits) / (state.iterations() * probes.size());
+    }
+
+    void Dimensions(benchmark::internal::Benchmark *benchmark)
+    {
+        for (int dimension : {16, 50, 64, 100, 256, 512, 1000})
+        {
+            benchmark->Arg(dimension);
+        }
+        benchmark->Unit(benchmark::kMicrosecond);
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_Insert, PlqtSet)->Apply(Dimensions);
+BENCHMARK_TEMPLATE(BM_Insert, HashedSet)->Apply(Dimensions);
+BENCHMARK_TEMPLATE(BM_Insert, SortedBitsetSet)->Apply(Dimensions);
+BENCHMARK_TEMPLATE(BM_Search, PlqtSet)->Apply(Dimensions);
+BENCHMARK_TEMPLATE(BM_Search, HashedSet)->Apply(Dimensions);
+BENCHMARK_TEMPLATE(BM_Search, SortedBitsetSet)->Apply(Dimensions);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,195 @@
+#include <benchmark/benchmark.h>
+#include "Reader/auto_instance_reader.h"
+#include "Reader/instance_batch_loader.h"
+#include "TabuSearch/tabu_search_solver.h"
+#include "TransportProblem/transport_problem.h"
+#include "../allocation_counter.h"
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Benchmarks the three layers of the solver on every instance of a directory
+// (instances/Beasley by default, or the first argument left after the
+// benchmark flags): a full transportation solve, a facility toggle followed
+// by a subproblem solve, and a complete tabu search. The transportation
+// solve runs once per construction of the initial flow (see InitialFlow).
+// Besides the time per operation, each benchmark reports solves per second
+// and the heap traffic of the timed code, so regressions in either show up
+// in the JSON output.
+
+namespace
+{
+    const std::pair<InitialFlow, const char *> kInitialFlows[] = {
+        {InitialFlow::Sequential, "sequential"},
+        {InitialFlow::Greedy, "greedy"},
+        {InitialFlow::Vogel, "vogel"},
+        {InitialFlow::Russell, "russell"}};
+
+    /// Accumulates the allocations made while the benchmark timer runs.
+    class AllocationMeter
+    {
+    public:
+        void start() { before_ = currentAllocationStats(); }
+
+        void stop()
+        {
+            AllocationStats after = currentAllocationStats();
+            allocations_ += after.allocations - before_.allocations;
+            bytes_ += after.totalBytes - before_.totalBytes;
+        }
+
+        void report(benchmark::State &state) const
+        {
+            double iterations = static_cast<double>(state.iterations());
+            state.counters["solves_per_second"] =
+                benchmark::Counter(iterations, benchmark::Counter::kIsRate);
+            state.counters["bytes_per_op"] = static_cast<double>(bytes_) / iterations;
+            state.counters["allocs_per_op"] = static_cast<double>(allocations_) / iterations;
+        }
+
+    private:
+        AllocationStats before_{};
+        uint64_t allocations_ = 0;
+        uint64_t bytes_ = 0;
+    };
+
+    void BM_TransportHungarian(benchmark::State &state, std::shared_ptr<const CFLPProblem> problem,
+                               InitialFlow method)
+    {
+        const std::vector<int> &capacities = problem->getCapacities();
+        const std::vector<int> &demands = problem->getDemands();
+        int totalSupply = std::accumulate(capacities.begin(), capacities.end(), 0);
+
+        AllocationMeter meter;
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            TransportationProblem transport(capacities, demands, problem->getCostMatrix());
+            transport.setTotalSupply(totalSupply);
+            transport.setTotalDemand(problem->getTotalDemand());
+            transport.balance();
+            transport.setInitialFlow(method);
+            meter.start();
+            state.ResumeTiming();
+
+            transport.solveHungarianMethod();
+            benchmark::DoNotOptimize(transport.getTotalCost());
+
+            state.PauseTiming();
+            meter.stop();
+            state.ResumeTiming();
+        }
+        meter.report(state);
+    }
+
+    void BM_SubproblemToggle(benchmark::State &state, std::shared_ptr<const CFLPProblem> problem)
+    {
+        const std::vector<int> &capacities = problem->getCapacities();
+        int facilities = static_cast<int>(capacities.size());
+        std::vector<int> open(facilities, 1);
+        int supply = std::accumulate(capacities.begin(), capacities.end(), 0);
+
+        CFLPTransportSubproblem subproblem(problem->getCostMatrix(), capacities, problem->getDemands(), open);
+        subproblem.solve();
+
+        // Cierra y vuelve a abrir cada instalación por turno, sin dejar la oferta por debajo de la demanda
+        int next = 0;
+        AllocationMeter meter;
+        meter.start();
+        for (auto _ : state)
+        {
+            int facility = next;
+            while (open[facility] == 1 && supply - capacities[facility] < problem->getTotalDemand())
+            {
+                facility = (facility + 1) % facilities;
+                if (facility == next)
+                {
+                    state.SkipWithError("no facility can be closed");
+                    return;
+                }
+            }
+            supply += open[facility] == 1 ? -capacities[facility] : capacities[facility];
+            open[facility] ^= 1;
+            if (open[facility] == 1)
+            {
+                next = (facility + 1) % facilities;
+            }
+            else
+            {
+                next = facility;
+            }
+
+            subproblem.toggleFacility(facility);
+            subproblem.solve();
+            benchmark::DoNotOptimize(subproblem.getTotalCost());
+        }
+        meter.stop();
+        meter.report(state);
+    }
+
+    void BM_TabuSolve(benchmark::State &state, std::shared_ptr<const CFLPProblem> problem)
+    {
+        AllocationMeter meter;
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            CFLPProblem copy = *problem;
+            meter.start();
+            state.ResumeTiming();
+
+            TabuSearchSolver solver(copy);
+            solver.solve();
+            benchmark::DoNotOptimize(solver.getBestCost());
+
+            state.PauseTiming();
+            meter.stop();
+            state.ResumeTiming();
+        }
+        meter.report(state);
+    }
+
+    void registerInstances(const std::string &directory)
+    {
+        AutoInstanceReader reader;
+        for (const std::string &path : InstanceBatchLoader::listFiles(directory))
+        {
+            std::string name = std::filesystem::path(path).stem().string();
+            std::shared_ptr<const CFLPProblem> problem;
+            try
+            {
+                problem = std::make_shared<const CFLPProblem>(reader.readInstance(path));
+            }
+            catch (const std::exception &error)
+            {
+                std::cerr << "skipping " << error.what() << std::endl;
+                continue;
+            }
+
+            for (const auto &[method, label] : kInitialFlows)
+            {
+                benchmark::RegisterBenchmark(("BM_TransportHungarian/" + name + "/" + label).c_str(),
+                                             BM_TransportHungarian, problem, method)
+                    ->Unit(benchmark::kMicrosecond);
+            }
+            benchmark::RegisterBenchmark(("BM_SubproblemToggle/" + name).c_str(), BM_SubproblemToggle, problem)
+                ->Unit(benchmark::kMicrosecond);
+            benchmark::RegisterBenchmark(("BM_TabuSolve/" + name).c_str(), BM_TabuSolve, problem)
+                ->Unit(benchmark::kMillisecond)
+                ->Iterations(1);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    benchmark::Initialize(&argc, argv);
+    std::string directory = argc > 1 ? argv[1] : CFLP_INSTANCES_DIR "/Beasley";
+    registerInstances(directory);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include "allocation_counter.h"
+
+#ifdef CFLP_ALLOCATION_TRACKING
+#include "Utils/memory_accounting.h"
+
+// La biblioteca ya reemplaza operator new/delete; se leen sus contadores del hilo actual
+AllocationStats currentAllocationStats()
+{
+    MemoryAccounting::Usage total = MemoryAccounting::threadUsage().total();
+    return {total.allocations, total.totalBytes, total.currentBytes};
+}
+#else
+#include <atomic>
+#include <cstdlib>
+#include <malloc.h>
+#include <new>
+
+namespace
+{
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> totalBytes{0};
+    std::atomic<int64_t> liveBytes{0};
+
+    void *countedAllocate(std::size_t size)
+    {
+        void *ptr = std::malloc(size == 0 ? 1 : size);
+        if (ptr == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        totalBytes.fetch_add(size, std::memory_order_relaxed);
+        liveBytes.fetch_add(static_cast<int64_t>(malloc_usable_size(ptr)), std::memory_order_relaxed);
+        return ptr;
+    }
+
+    void countedFree(void *ptr)
+    {
+        if (ptr != nullptr)
+        {
+            liveBytes.fetch_sub(static_cast<int64_t>(malloc_usable_size(ptr)), std::memory_order_relaxed);
+            std::free(ptr);
+        }
+    }
+}
+
+AllocationStats currentAllocationStats()
+{
+    return {allocations.load(std::memory_order_relaxed),
+            totalBytes.load(std::memory_order_relaxed),
+            liveBytes.load(std::memory_order_relaxed)};
+}
+
+void *operator new(std::size_t size)
+{
+    return countedAllocate(size);
+}
+
+void *operator new[](std::size_t size)
+{
+    return countedAllocate(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    countedFree(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    countedFree(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    countedFree(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+    countedFree(ptr);
+}
+#endif
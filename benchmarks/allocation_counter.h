@@ -0,0 +1,23 @@
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <cstdint>
+
+/**
+ * @brief Heap usage observed by the replacement operator new/delete linked
+ * into the benchmark executables.
+ *
+ * With CFLP_ALLOCATION_TRACKING the library's replacement is used instead,
+ * and the values are those of the calling thread.
+ */
+struct AllocationStats
+{
+    uint64_t allocations;  ///< Number of calls to operator new.
+    uint64_t totalBytes;   ///< Bytes requested by operator new since start.
+    int64_t liveBytes;     ///< Usable bytes currently allocated.
+};
+
+/** @brief Returns a snapshot of the global allocation counters. */
+AllocationStats currentAllocationStats();
+
+#endif // ALLOCATION_COUNTER_H
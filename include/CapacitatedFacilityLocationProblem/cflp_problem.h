@@ -2,6 +2,9 @@
 #define CFLP_PROBLEM_H
 
 #include "../TransportProblem/cflp_tansport_problem.h"
+#include "PLQT/plqt.h"
+#include "Utils/cost_traits.h"
+#include <cstdint>
 #include <vector>
 #include <numeric>
 
@@ -12,10 +15,18 @@
  * This class contains the main state and control logic for solving CFLP via metaheuristics
  * such as Tabu Search. It holds information about the current and best solutions,
  * and provides interfaces for managing problem state.
+ *
+ * @tparam Cost Type of the transportation costs (see CostTraits). Opening
+ * costs are kept as read and converted with CostTraits<Cost>::fromDecimal
+ * when they are added to the objective, which is accumulated in 64 bits.
  */
-class CFLPProblem
+template <typename Cost>
+class BasicCFLPProblem
 {
 public:
+    using CostMatrix = std::vector<std::vector<Cost>>;
+    using Accumulator = typename CostTraits<Cost>::Accumulator;
+
     /**
      * @brief Constructor.
      * @param costMatrix Full cost matrix (facilities x clients).
@@ -23,24 +34,28 @@ public:
      * @param demands Vector of client demands.
      * @param openingCosts Vector of facility opening costs.
      */
-    CFLPProblem(std::vector<std::vector<int>> costMatrix,
-                std::vector<int> capacities,
-                std::vector<int> demands,
-                std::vector<double> openingCosts);
+    BasicCFLPProblem(CostMatrix costMatrix,
+                     std::vector<int> capacities,
+                     std::vector<int> demands,
+                     std::vector<double> openingCosts);
 
     /// Destructor.
-    ~CFLPProblem() = default;
+    ~BasicCFLPProblem() = default;
 
-    int getCurrentCost() const;
-    void setCurrentCost(int cost);
+    Accumulator getCurrentCost() const;
+    void setCurrentCost(Accumulator cost);
 
     const std::vector<int> &getBestSolution() const;
     void setBestSolution(const std::vector<int> &solution);
 
-    CFLPTransportSubproblem &getSubproblem();
+    /**
+     * @brief Returns the transport subproblem, solving it first if a cached
+     * cost was used for the current configuration.
+     */
+    BasicCFLPTransportSubproblem<Cost> &getSubproblem();
 
-    const std::vector<std::vector<int>> &getCostMatrix() const;
-    std::vector<std::vector<int>> &getCostMatrix();
+    const CostMatrix &getCostMatrix() const;
+    CostMatrix &getCostMatrix();
 
     const std::vector<int> &getCapacities() const;
     std::vector<int> &getCapacities();
@@ -51,28 +66,90 @@ public:
     const std::vector<double> &getOpeningCosts() const;
     std::vector<double> &getOpeningCosts();
 
+    /**
+     * @brief Returns a hash identifying the instance data.
+     *
+     * FNV-1a over the cost type, the sizes, the cost matrix (already in the
+     * cost scale of the instance), the capacities, the demands and the opening
+     * costs. Files that memoize costs (PLQT snapshots, solver checkpoints)
+     * record it, so they are never applied to another instance of the same size.
+     */
+    uint64_t getInstanceFingerprint() const;
+
     void initializeSubproblem(const std::vector<int> &solution);
 
-    int getCostOfFacilities() const;
-    int getCostOfTransportation() const;
+    /**
+     * @brief Selects the construction of the initial flow of every transport solve.
+     * Kept across initializeSubproblem(); Sequential by default.
+     * @param method Construction of the initial flow (see InitialFlow).
+     */
+    void setInitialFlow(InitialFlow method);
+
+    Accumulator getCostOfFacilities() const;
+    Accumulator getCostOfTransportation() const;
     int getTotalDemand() const;
     int getCurrentTotalSupply() const;
     void setCurrentTotalSupply(int supply);
 
+    /**
+     * @brief Toggles a facility and updates the current cost.
+     *
+     * If a solution cache is attached and already holds the cost of the new
+     * configuration, the transport subproblem is not solved; it is solved
+     * lazily the next time getSubproblem() is called.
+     * @param facilityIndex Index of the facility to toggle.
+     */
     void toggleFacility(int facilityIndex);
 
+    /**
+     * @brief Toggles a facility, abandoning the transport solve once the new
+     * cost provably reaches a cutoff.
+     *
+     * Meant for evaluating candidate moves: a dominated candidate costs only
+     * the Hungarian iterations needed to prove it. getCurrentCost() then
+     * returns a lower bound of at least the cutoff, and the subproblem is
+     * solved in full the next time getSubproblem() is called.
+     * @param facilityIndex Index of the facility to toggle.
+     * @param cutoff Total cost the caller needs to beat.
+     * @return true if getCurrentCost() is exact; false if the configuration is dominated.
+     */
+    bool toggleFacility(int facilityIndex, Accumulator cutoff);
+
+    /**
+     * @brief Attaches a PLQT whose nodes memoize the cost of visited configurations.
+     * The cache is only consulted when Accumulator is an integer type.
+     * @param cache Tree to consult on each toggle, or nullptr to always solve.
+     */
+    void setSolutionCache(const PLQT *cache);
+
+    /**
+     * @brief Returns true if the current cost came from the cache and the
+     * transport subproblem has not been solved for the current configuration.
+     */
+    bool isTransportStale() const;
+
 private:
-    int currentCost_;
+    Accumulator currentCost_;
     std::vector<int> bestSolution_;
-    CFLPTransportSubproblem subproblem_;
-    std::vector<std::vector<int>> costMatrix_;
+    BasicCFLPTransportSubproblem<Cost> subproblem_;
+    CostMatrix costMatrix_;
     std::vector<int> capacities_;
     std::vector<int> demands_;
     std::vector<double> openingCosts_;
-    int costOfFacilities_ = 0;
-    int costOfTransportation_ = 0;
+    Accumulator costOfFacilities_ = 0;
+    Accumulator costOfTransportation_ = 0;
     int totalDemand_;
     int currentTotalSupply_ = 0;
+    const PLQT *solutionCache_ = nullptr;
+    InitialFlow initialFlow_ = InitialFlow::Sequential;
+    bool transportStale_ = false;
 };
 
+extern template class BasicCFLPProblem<int32_t>;
+extern template class BasicCFLPProblem<int64_t>;
+extern template class BasicCFLPProblem<double>;
+
+/// CFLP instance with integer transportation costs.
+using CFLPProblem = BasicCFLPProblem<int>;
+
 #endif // CFLP_PROBLEM_H
@@ -0,0 +1,89 @@
+#ifndef CFLP_SOLUTION_H
+#define CFLP_SOLUTION_H
+
+#include "CapacitatedFacilityLocationProblem/cflp_problem.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Units of demand shipped from one facility to one customer.
+ */
+struct SolutionAssignment
+{
+    size_t facility; ///< Index of the facility.
+    size_t customer; ///< Index of the customer.
+    int amount;      ///< Units shipped.
+};
+
+/**
+ * @class CFLPSolution
+ * @brief A CFLP solution that can be saved and loaded as a small text file.
+ *
+ * The file lists the sizes of the instance, the cost, the indices of the
+ * open facilities and, optionally, the non-zero entries of the assignment
+ * matrix:
+ *
+ *     CFLPSOL 1
+ *     <facilities> <customers>
+ *     cost <value>
+ *     open <count>
+ *     <facility>...
+ *     assignments <count>
+ *     <facility> <customer> <amount>
+ *     ...
+ *
+ * Only open facilities and used arcs are written, so a solution stays small
+ * even for large instances.
+ */
+class CFLPSolution
+{
+public:
+    /**
+     * @brief Creates a solution.
+     * @param open Status of each facility (1 open, 0 closed).
+     * @param customers Number of customers of the instance.
+     * @param cost Total cost of the solution.
+     * @param assignments Non-zero shipments; may be empty.
+     * @throws std::invalid_argument If a status is not 0 or 1 or an assignment is out of range.
+     */
+    CFLPSolution(std::vector<int> open, size_t customers, double cost,
+                 std::vector<SolutionAssignment> assignments = {});
+
+    /**
+     * @brief Evaluates a configuration on a problem and captures the result.
+     *
+     * Solves the transportation subproblem for the configuration, so the
+     * problem is left with that configuration as its current solution.
+     * @param problem Instance to evaluate on.
+     * @param open Status of each facility.
+     * @param withAssignments Whether to keep the assignment matrix.
+     */
+    static CFLPSolution evaluate(CFLPProblem &problem, const std::vector<int> &open, bool withAssignments);
+
+    /**
+     * @brief Reads a solution file.
+     * @throws std::runtime_error If the file cannot be read or is malformed.
+     */
+    static CFLPSolution read(const std::string &path);
+
+    /**
+     * @brief Writes the solution to a file.
+     * @throws std::runtime_error If the file cannot be written.
+     */
+    void write(const std::string &path) const;
+
+    const std::vector<int> &getOpenFacilities() const;
+    size_t getFacilityCount() const;
+    size_t getCustomerCount() const;
+    double getCost() const;
+    const std::vector<SolutionAssignment> &getAssignments() const;
+
+private:
+    std::vector<int> open_;
+    size_t customers_;
+    double cost_;
+    std::vector<SolutionAssignment> assignments_;
+};
+
+#endif // CFLP_SOLUTION_H
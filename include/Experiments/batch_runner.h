@@ -0,0 +1,97 @@
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#include "CapacitatedFacilityLocationProblem/cflp_problem.h"
+#include "Utils/instrumentation.h"
+#include "Utils/memory_accounting.h"
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Options of BatchRunner.
+ */
+struct BatchRunOptions
+{
+    std::vector<std::string> instances;   ///< Instance files, directories or glob patterns.
+    std::vector<unsigned> seeds = {1};    ///< Seeds of the tabu search; one run per seed.
+    std::vector<double> timeLimits = {0}; ///< Time limits in seconds (0 for none); one run per limit.
+    unsigned threads = 0;                 ///< Concurrent solves; 0 for all cores.
+    bool allocationCosts = true;          ///< Costs in the files are for a customer's whole demand (Beasley convention).
+    double costScale = 1000.0;            ///< Unit costs and opening costs are multiplied by this before rounding to integers.
+    std::string traceDirectory;           ///< If set, the moves of each run are written there as <stem>_seed<S>_limit<T>.csv.
+};
+
+/**
+ * @brief Outcome of one solve of a batch.
+ */
+struct BatchRunResult
+{
+    std::string instance;           ///< Path of the instance file.
+    unsigned seed = 0;              ///< Seed of the run.
+    double timeLimit = 0.0;         ///< Time limit of the run (0 for none).
+    double objective = 0.0;         ///< Best cost found.
+    double timeToBest = 0.0;        ///< Seconds until the best cost was found.
+    double totalTime = 0.0;         ///< Seconds of the whole solve.
+    int iterations = 0;             ///< Moves executed by the tabu search.
+    int openFacilities = 0;         ///< Open facilities in the best solution.
+    std::optional<double> optimum;  ///< Published optimum, if known (see knownOptimum()).
+    std::optional<double> gap;      ///< Percent gap of objective over optimum, if known.
+    std::string error;              ///< Load or solve error; empty on success.
+    Instrumentation::Report instrumentation; ///< Hot-path counters of the solve (see Utils/instrumentation.h).
+    MemoryAccounting::Report memory;         ///< Heap usage of the solve (see Utils/memory_accounting.h).
+};
+
+/**
+ * @class BatchRunner
+ * @brief Runs the tabu search over every combination of instance, seed and time limit.
+ *
+ * Instances are loaded concurrently with InstanceBatchLoader, then the runs
+ * are solved on a pool of threads, one TabuSearchSolver per run. Results are
+ * returned in a fixed order (instance, then seed, then time limit)
+ * whatever the scheduling, and can be written as CSV or JSON.
+ *
+ * The transportation subproblem multiplies unit costs by shipped units,
+ * while the Beasley files give the cost of serving a customer's whole
+ * demand. With allocationCosts, each cost is divided by the customer's
+ * demand before solving, so objectives match the published optima. Costs
+ * are read exactly and scaled by costScale before rounding to the integer
+ * costs of CFLPProblem; reported objectives are divided back.
+ */
+class BatchRunner
+{
+public:
+    /**
+     * @brief Creates a runner.
+     * @throws std::invalid_argument If no instance, seed or time limit is given.
+     */
+    explicit BatchRunner(BatchRunOptions options);
+
+    /**
+     * @brief Solves every run.
+     * @throws std::runtime_error If a directory or pattern matches no directory.
+     */
+    std::vector<BatchRunResult> run() const;
+
+    /**
+     * @brief Reads an instance in any supported format and converts its costs as the runs do.
+     * @param path Instance file.
+     * @param allocationCosts Whether the costs are for a customer's whole demand.
+     * @param costScale Factor applied before rounding the costs to integers.
+     */
+    static CFLPProblem loadInstance(const std::string &path, bool allocationCosts, double costScale);
+
+    /** @brief Writes one CSV row per result, with a header. */
+    static void writeCsv(const std::vector<BatchRunResult> &results, std::ostream &out);
+
+    /** @brief Writes the results as a JSON array of objects. */
+    static void writeJson(const std::vector<BatchRunResult> &results, std::ostream &out);
+
+private:
+    BatchRunOptions options_;
+
+    std::vector<std::string> instanceFiles() const;
+};
+
+#endif // BATCH_RUNNER_H
@@ -0,0 +1,21 @@
+#ifndef KNOWN_OPTIMA_H
+#define KNOWN_OPTIMA_H
+
+#include <optional>
+#include <string>
+
+/**
+ * @brief Returns the published optimal value of an OR-Library instance.
+ *
+ * Covers cap41-cap134 and capa, capb and capc with the capacities that
+ * BeasleyInstanceReader uses by default for them (8000, 5000 and 5000).
+ * The values are for the exact fractional costs; the integer CFLPProblem
+ * truncates costs, so its objective can be slightly below them.
+ *
+ * @param name Instance name, file name or path ("cap41", "cap41.txt" or
+ * "instances/Beasley/cap41.txt").
+ * @return The optimum, or nothing if the instance is not in the table.
+ */
+std::optional<double> knownOptimum(const std::string &name);
+
+#endif // KNOWN_OPTIMA_H
@@ -0,0 +1,164 @@
+#ifndef SOLVE_SERVICE_H
+#define SOLVE_SERVICE_H
+
+#include "CapacitatedFacilityLocationProblem/cflp_problem.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief A request to SolveService.
+ *
+ * On the wire a request is a frame whose payload holds "key=value" lines:
+ * - id: echoed in the response, to match responses sent out of order;
+ * - command: solve (default), stats or shutdown;
+ * - instance: path of the instance file;
+ * - seed, time_limit: as in BatchRunOptions (defaults 1 and 0);
+ * - initial: start configuration as a string of 0/1, one per facility;
+ * - unit_costs, cost_scale: cost conversion, as in BatchRunOptions.
+ */
+struct SolveRequest
+{
+    std::string id;
+    std::string command = "solve";
+    std::string instance;
+    unsigned seed = 1;
+    double timeLimit = 0.0;
+    std::vector<int> initial;
+    bool allocationCosts = true;
+    double costScale = 1000.0;
+
+    /**
+     * @brief Parses a request payload.
+     * @throws std::invalid_argument If a line is malformed, a key is unknown or a value is invalid.
+     */
+    static SolveRequest parse(const std::string &payload);
+};
+
+/**
+ * @class SolveService
+ * @brief Long-running solver that keeps instances resident between requests.
+ *
+ * Each instance is read once, the first time a request names it with a
+ * given cost conversion, and later requests copy the resident problem
+ * instead of parsing the file again. Solves run on a fixed pool of worker
+ * threads, so several requests, from one client or many, are served at
+ * the same time.
+ *
+ * Requests and responses are frames: a 4-byte big-endian payload length
+ * followed by the payload. A response holds "key=value" lines with the
+ * request id, status (ok or error) and, for a solve, objective (on the
+ * instance's scale), open (0/1 string), time_to_best, total_time and
+ * iterations; failures carry an error line instead.
+ */
+class SolveService
+{
+public:
+    /**
+     * @param workers Number of concurrent solves; 0 for all cores.
+     */
+    explicit SolveService(unsigned workers = 0);
+
+    /** @brief Finishes the queued requests and stops the workers. */
+    ~SolveService();
+
+    SolveService(const SolveService &) = delete;
+    SolveService &operator=(const SolveService &) = delete;
+
+    /**
+     * @brief Serves one request payload on the calling thread.
+     * @return Response payload; errors are reported in it, never thrown.
+     */
+    std::string handle(const std::string &payload);
+
+    /**
+     * @brief Queues a request for the worker pool.
+     * @param payload Request payload.
+     * @param reply Called from a worker thread with the response payload.
+     */
+    void submit(std::string payload, std::function<void(const std::string &)> reply);
+
+    /**
+     * @brief Serves the frames read from a file descriptor until end of input or shutdown.
+     * Responses are written to out as they complete; returns once all have been written.
+     * @param in Descriptor to read requests from (for example 0 for stdin).
+     * @param out Descriptor to write responses to (for example 1 for stdout).
+     */
+    void serveStream(int in, int out);
+
+    /**
+     * @brief Listens on a Unix domain socket until a shutdown request arrives.
+     * Each connection is served like serveStream(); a socket left at path by an
+     * earlier run is replaced, any other file is left untouched.
+     * @param path Socket path.
+     * @throws std::runtime_error If the socket cannot be created or path exists and is not a socket.
+     */
+    void serveSocket(const std::string &path);
+
+    /** @brief Makes serveSocket() and serveStream() return after the requests in progress. */
+    void shutdown();
+
+    /** @brief Returns true once shutdown() has been called or requested. */
+    bool isShutDown() const;
+
+    /** @brief Number of resident instances. */
+    size_t residentInstances() const;
+
+    /** @brief Number of solve requests served. */
+    size_t servedRequests() const;
+
+    /**
+     * @brief Number of connection threads held by serveSocket().
+     * Threads of closed connections are joined within one poll interval (100 ms).
+     */
+    size_t connectionThreads() const;
+
+    /**
+     * @brief Reads one frame.
+     * @return false at end of input before a frame starts.
+     * @throws std::runtime_error On a read error, a truncated frame or a payload over 16 MiB.
+     */
+    static bool readFrame(int fd, std::string &payload);
+
+    /**
+     * @brief Writes one frame.
+     * @throws std::runtime_error On a write error.
+     */
+    static void writeFrame(int fd, const std::string &payload);
+
+private:
+    struct Job
+    {
+        std::string payload;
+        std::function<void(const std::string &)> reply;
+    };
+
+    std::shared_ptr<const CFLPProblem> resident(const SolveRequest &request);
+    std::string solve(const SolveRequest &request);
+    void work();
+
+    // Instancias residentes por ruta y conversión de costos; la carga ocurre una sola vez
+    mutable std::mutex cacheMutex_;
+    std::map<std::string, std::shared_future<std::shared_ptr<const CFLPProblem>>> cache_;
+
+    std::mutex queueMutex_;
+    std::condition_variable queueReady_;
+    std::deque<Job> queue_;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+
+    std::atomic<bool> shutDown_{false};
+    std::atomic<size_t> served_{0};
+    std::atomic<size_t> connectionThreads_{0};
+};
+
+#endif // SOLVE_SERVICE_H
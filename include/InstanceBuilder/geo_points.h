@@ -0,0 +1,61 @@
+#ifndef GEO_POINTS_H
+#define GEO_POINTS_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class GeoPoints
+ * @brief Points on the Earth stored as unit vectors, one array per coordinate.
+ *
+ * Great-circle distances are computed from the chord between unit vectors,
+ * which is equivalent to the haversine formula: the chord length c gives the
+ * central angle 2 asin(c / 2). The first pass over the structure-of-arrays
+ * layout is plain arithmetic that the compiler vectorizes; the second applies
+ * asin to the whole row.
+ */
+class GeoPoints
+{
+public:
+    /// Mean Earth radius in kilometres.
+    static constexpr double kEarthRadiusKm = 6371.0088;
+
+    /**
+     * @brief Adds a point.
+     * @param latitude Latitude in degrees.
+     * @param longitude Longitude in degrees.
+     */
+    void add(double latitude, double longitude);
+
+    /** @brief Returns the number of points. */
+    size_t size() const;
+
+    /**
+     * @brief Computes the great-circle distance from one point to every point.
+     * @param from Index of the origin point.
+     * @param distancesKm Output, size() values in kilometres.
+     */
+    void distancesFrom(size_t from, double *distancesKm) const;
+
+    /**
+     * @brief Computes the great-circle distance from an external point to every point.
+     * @param latitude Latitude of the origin in degrees.
+     * @param longitude Longitude of the origin in degrees.
+     * @param distancesKm Output, size() values in kilometres.
+     */
+    void distancesFrom(double latitude, double longitude, double *distancesKm) const;
+
+    /**
+     * @brief Haversine distance between two points, in kilometres.
+     */
+    static double haversineKm(double latitude1, double longitude1, double latitude2, double longitude2);
+
+private:
+    std::vector<double> x_;
+    std::vector<double> y_;
+    std::vector<double> z_;
+
+    void distancesFromVector(double x, double y, double z, double *distancesKm) const;
+};
+
+#endif // GEO_POINTS_H
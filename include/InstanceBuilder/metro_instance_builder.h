@@ -0,0 +1,111 @@
+#ifndef METRO_INSTANCE_BUILDER_H
+#define METRO_INSTANCE_BUILDER_H
+
+#include "CapacitatedFacilityLocationProblem/cflp_problem.h"
+#include "InstanceBuilder/station_graph.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief A station read from the STATION table.
+ */
+struct MetroStation
+{
+    int64_t id;         ///< STATION.ID.
+    std::string name;   ///< Station name.
+    int64_t annualFlow; ///< Passengers per year, used as demand.
+    double latitude;    ///< Latitude in degrees.
+    double longitude;   ///< Longitude in degrees.
+};
+
+/**
+ * @brief Stations and connections of a metro database.
+ */
+struct MetroNetwork
+{
+    std::vector<MetroStation> stations;          ///< Stations ordered by ID.
+    std::vector<StationGraph::Edge> connections; ///< Connections as indices into stations.
+    std::vector<double> lengths;                 ///< Track length of each connection in metres (CONNECTION.DISTANCE).
+};
+
+/// Length of a connection in the station graph.
+enum class MetroDistance
+{
+    Metres, ///< Track length of the connection, in metres.
+    Hops    ///< Every connection counts as one.
+};
+
+/**
+ * @brief Options of MetroInstanceBuilder.
+ */
+struct MetroOptions
+{
+    MetroDistance distance = MetroDistance::Metres; ///< Length of each connection.
+    size_t facilities = 0;               ///< Candidate service points at the busiest stations, in ID order; 0 for all.
+    double flowPerDemandUnit = 100000.0; ///< Demand of a station is ceil(annual flow / this).
+    double capacityFactor = 3.0;         ///< Total capacity over total demand, split evenly.
+    double openingCost = 1.0e8;          ///< Opening cost of every service point.
+    double costPerUnit = 1.0;            ///< Unit transportation cost per metre or hop.
+    unsigned threads = 0;                ///< Threads running shortest paths; 0 for all cores.
+};
+
+/**
+ * @class MetroInstanceBuilder
+ * @brief Builds CFLP instances for siting service points on a metro network.
+ *
+ * Reads the STATION and CONNECTION tables of a SQLite database such as
+ * db/Metro_CDMX.sqlite3. Every station is a customer whose demand is its
+ * annual flow; service points can be opened at the busiest stations. The
+ * unit transportation cost is the network distance along the track
+ * (CONNECTION.DISTANCE, in metres), computed with one shortest-path search
+ * per candidate station, in parallel.
+ */
+class MetroInstanceBuilder
+{
+public:
+    /**
+     * @brief Creates a builder over a database file.
+     * @param databasePath Path of a SQLite database with STATION and CONNECTION tables.
+     */
+    explicit MetroInstanceBuilder(std::string databasePath);
+
+    /**
+     * @brief Reads the stations and connections.
+     * @throws std::runtime_error If the database cannot be read or a connection
+     * refers to an unknown station.
+     */
+    MetroNetwork loadNetwork() const;
+
+    /**
+     * @brief Builds the station graph of a network.
+     * @throws std::invalid_argument If distance is Metres and the network does not
+     * have one length per connection.
+     */
+    static StationGraph buildGraph(const MetroNetwork &network, MetroDistance distance);
+
+    /**
+     * @brief Builds an instance with integer costs.
+     * @throws std::runtime_error If the database cannot be read.
+     * @throws std::invalid_argument If the network is empty or disconnected.
+     */
+    CFLPProblem build(const MetroOptions &options) const;
+
+    /**
+     * @brief Builds an instance with the given cost type.
+     * @tparam Cost int32_t, int64_t (fixed point) or double.
+     */
+    template <typename Cost>
+    BasicCFLPProblem<Cost> buildAs(const MetroOptions &options) const;
+
+    /**
+     * @brief Builds an instance from a network already loaded.
+     */
+    template <typename Cost>
+    static BasicCFLPProblem<Cost> buildFromNetwork(const MetroNetwork &network, const MetroOptions &options);
+
+private:
+    std::string databasePath_;
+};
+
+#endif // METRO_INSTANCE_BUILDER_H
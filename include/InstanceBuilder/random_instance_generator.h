@@ -0,0 +1,97 @@
+#ifndef RANDOM_INSTANCE_GENERATOR_H
+#define RANDOM_INSTANCE_GENERATOR_H
+
+#include "CapacitatedFacilityLocationProblem/cflp_problem.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Options of RandomInstanceGenerator.
+ */
+struct RandomInstanceOptions
+{
+    size_t facilities = 100;    ///< Number of facilities (m).
+    size_t customers = 1000;    ///< Number of customers (n).
+    double capacityRatio = 3.0; ///< Total capacity over total demand; at least 1.
+    uint64_t seed = 1;          ///< Seed of the instance.
+    unsigned threads = 0;       ///< Threads generating blocks; 0 for all cores.
+};
+
+/**
+ * @class RandomInstanceGenerator
+ * @brief Generates random CFLP instances in the style of Cornuéjols, Sridharan and Thizy (1991).
+ *
+ * Facilities and customers are uniform points in the unit square. Demands
+ * are uniform in [5, 35] and capacities in [10, 160], then scaled so that
+ * total capacity is capacityRatio times total demand. The opening cost of a
+ * facility with capacity s is U[0, 90] + U[100, 110] * sqrt(s), and the cost
+ * of serving all the demand d of a customer at distance e is 10 * d * e.
+ * Costs are rounded to three decimals, as in the Beasley files.
+ *
+ * Points are drawn in blocks of kBlockSize, each from its own generator
+ * seeded with (seed, block), so the instance only depends on the sizes, the
+ * ratio and the seed, never on the number of threads. The writers produce
+ * blocks of output in parallel and stream them to disk in order, so only a
+ * few blocks of the cost matrix are in memory at a time.
+ */
+class RandomInstanceGenerator
+{
+public:
+    /// Number of points drawn from each block generator.
+    static constexpr size_t kBlockSize = 1024;
+
+    /**
+     * @brief Draws the facilities and customers.
+     * @throws std::invalid_argument If a size is zero or the ratio is below 1.
+     */
+    explicit RandomInstanceGenerator(const RandomInstanceOptions &options);
+
+    /** @brief Returns the facility capacities. */
+    const std::vector<int> &getCapacities() const;
+
+    /** @brief Returns the customer demands. */
+    const std::vector<int> &getDemands() const;
+
+    /** @brief Returns the facility opening costs. */
+    const std::vector<double> &getOpeningCosts() const;
+
+    /**
+     * @brief Returns the cost of serving all of a customer's demand from a facility.
+     */
+    double cost(size_t facility, size_t customer) const;
+
+    /** @brief Builds the instance in memory with integer costs. */
+    CFLPProblem generate() const;
+
+    /**
+     * @brief Builds the instance in memory with the given cost type.
+     * @tparam Cost int32_t, int64_t (fixed point) or double.
+     */
+    template <typename Cost>
+    BasicCFLPProblem<Cost> generateAs() const;
+
+    /**
+     * @brief Writes the instance in the Beasley text format.
+     * @throws std::runtime_error If the file cannot be written.
+     */
+    void writeText(const std::string &path) const;
+
+    /**
+     * @brief Writes the instance in the binary format (see BinaryInstance).
+     * @throws std::runtime_error If the file cannot be written.
+     */
+    void writeBinary(const std::string &path) const;
+
+private:
+    unsigned threads_;
+    std::vector<double> facilityX_;
+    std::vector<double> facilityY_;
+    std::vector<double> customerX_;
+    std::vector<double> customerY_;
+    std::vector<int> capacities_;
+    std::vector<int> demands_;
+    std::vector<double> openingCosts_;
+};
+
+#endif // RANDOM_INSTANCE_GENERATOR_H
@@ -0,0 +1,68 @@
+#ifndef STATION_GRAPH_H
+#define STATION_GRAPH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @class StationGraph
+ * @brief Undirected graph in compressed adjacency form, for network distances.
+ *
+ * Unweighted graphs are searched with breadth-first search and weighted ones
+ * with Dijkstra's algorithm over a binary heap. Each search only reads the
+ * graph, so searches from different sources run in parallel.
+ */
+class StationGraph
+{
+public:
+    using Edge = std::pair<size_t, size_t>;
+
+    /**
+     * @brief Builds the graph.
+     * @param nodes Number of nodes.
+     * @param edges Undirected edges between node indices.
+     * @param weights Non-negative length of each edge, or empty to count hops.
+     * @throws std::invalid_argument If an edge is out of range or a weight is negative
+     * or the number of weights differs from the number of edges.
+     */
+    StationGraph(size_t nodes, const std::vector<Edge> &edges, const std::vector<double> &weights = {});
+
+    /** @brief Returns the number of nodes. */
+    size_t getNodeCount() const;
+
+    /** @brief Returns the number of undirected edges. */
+    size_t getEdgeCount() const;
+
+    /**
+     * @brief Computes the distance from a source to every node.
+     * @param source Index of the source node.
+     * @param distances Output, resized to getNodeCount(). Unreachable nodes get infinity.
+     */
+    void distancesFrom(size_t source, std::vector<double> &distances) const;
+
+    /**
+     * @brief Computes the distances from several sources, one search per source in parallel.
+     * @param sources Indices of the source nodes.
+     * @param threads Number of threads; 0 uses all cores.
+     * @return One row of getNodeCount() distances per source.
+     */
+    std::vector<std::vector<double>> distancesFrom(const std::vector<size_t> &sources, unsigned threads = 0) const;
+
+    /**
+     * @brief Computes the distances between every pair of nodes.
+     * @param threads Number of threads; 0 uses all cores.
+     */
+    std::vector<std::vector<double>> allPairs(unsigned threads = 0) const;
+
+private:
+    std::vector<size_t> offsets_;   ///< Start of the neighbours of each node.
+    std::vector<uint32_t> targets_; ///< Neighbour of each half-edge.
+    std::vector<double> lengths_;   ///< Length of each half-edge (empty if unweighted).
+
+    void breadthFirst(size_t source, std::vector<double> &distances) const;
+    void dijkstra(size_t source, std::vector<double> &distances) const;
+};
+
+#endif // STATION_GRAPH_H
@@ -0,0 +1,90 @@
+#ifndef WORLD_CITIES_BUILDER_H
+#define WORLD_CITIES_BUILDER_H
+
+#include "CapacitatedFacilityLocationProblem/cflp_problem.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief A city read from the worldcities table.
+ */
+struct City
+{
+    std::string name;   ///< ASCII name of the city.
+    std::string country; ///< Country name.
+    double latitude;     ///< Latitude in degrees.
+    double longitude;    ///< Longitude in degrees.
+    int64_t population;  ///< Population, used as demand.
+};
+
+/**
+ * @brief Options of WorldCitiesInstanceBuilder.
+ */
+struct WorldCitiesOptions
+{
+    std::vector<std::string> countries; ///< Countries to include; empty for all.
+    int64_t minPopulation = 0;          ///< Smallest population of a customer city.
+    size_t customers = 1000;            ///< Number of customer cities (most populated first); 0 for all.
+    size_t facilities = 100;            ///< Candidate facilities, placed at the most populated customers.
+    double populationPerDemandUnit = 1000.0; ///< Demand of a city is ceil(population / this).
+    double capacityFactor = 3.0;        ///< Total capacity over total demand, split evenly.
+    double openingCost = 1.0e6;         ///< Opening cost of every facility.
+    double costPerKm = 1.0;             ///< Unit transportation cost per kilometre.
+    unsigned threads = 0;               ///< Threads computing the cost matrix; 0 for all cores.
+};
+
+/**
+ * @class WorldCitiesInstanceBuilder
+ * @brief Builds CFLP instances from the worldcities table of a SQLite database.
+ *
+ * Customers are the most populated cities that pass the filters, with demand
+ * proportional to their population. Candidate facilities are placed at the
+ * most populated of them and all get the same capacity and opening cost. The
+ * unit transportation cost is the great-circle distance times costPerKm,
+ * computed row by row on several threads (see GeoPoints).
+ */
+class WorldCitiesInstanceBuilder
+{
+public:
+    /**
+     * @brief Creates a builder over a database file.
+     * @param databasePath Path of a SQLite database with a worldcities table
+     * (for example db/Mexico-US-Canada.sqlite3).
+     */
+    explicit WorldCitiesInstanceBuilder(std::string databasePath);
+
+    /**
+     * @brief Reads the cities that pass the filters, most populated first.
+     * @throws std::runtime_error If the database cannot be opened or queried.
+     */
+    std::vector<City> loadCities(const WorldCitiesOptions &options) const;
+
+    /**
+     * @brief Builds an instance with integer costs.
+     * @throws std::runtime_error If the database cannot be read.
+     * @throws std::invalid_argument If the options select no customer or facility.
+     */
+    CFLPProblem build(const WorldCitiesOptions &options) const;
+
+    /**
+     * @brief Builds an instance with the given cost type.
+     * @tparam Cost int32_t, int64_t (fixed point) or double.
+     */
+    template <typename Cost>
+    BasicCFLPProblem<Cost> buildAs(const WorldCitiesOptions &options) const;
+
+    /**
+     * @brief Builds an instance from cities already loaded.
+     * @param cities Customer cities, most populated first.
+     * @param options Facility count, capacities, costs and threads.
+     */
+    template <typename Cost>
+    static BasicCFLPProblem<Cost> buildFromCities(const std::vector<City> &cities,
+                                                  const WorldCitiesOptions &options);
+
+private:
+    std::string databasePath_;
+};
+
+#endif // WORLD_CITIES_BUILDER_H
@@ -5,22 +5,33 @@
 #include "PLQT/power_of_two.h"
 #include <vector>
 #include <string>
+#include <optional>
 
 /**
  * @class PLQT
  * @brief Represents a Primogenitary Linked Quad Tree (PLQT) structure for storing binary vectors.
+ *
+ * The successorship of a vector with respect to a node has one bit per
+ * component, so any dimension is supported; siblings are ordered by that
+ * key read as an unsigned integer.
  */
 class PLQT {
 private:
     PLQTNode* root;
     int dimension;
     PowerOfTwo powerOfTwo;
+    // Successor key of the last calculateSuccessorship call, one bit per
+    // component packed in 64-bit words. Reused so that insert and search do
+    // not allocate; this makes concurrent calls on one tree unsafe.
+    mutable std::vector<uint64_t> successorKey_;
 
     void preOrderTraversal(PLQTNode* node, std::vector<std::string>& output, int indent = 0) const;
     PLQTNode* insertNode(PLQTNode* current, const std::vector<int>& data);
     bool compareTrees(PLQTNode* a, PLQTNode* b) const;
-    int calculateSuccessorship(PLQTNode* node, const std::vector<int>& data) const;
+    void calculateSuccessorship(PLQTNode* node, const std::vector<int>& data) const;
+    bool isZeroSuccessor() const;
     PLQTNode* searchNode(PLQTNode* current, const std::vector<int>& data) const;
+    void deleteTree(PLQTNode* node);
 public:
     /**
      * @brief Constructs an empty PLQT with a given vector dimension.
@@ -30,6 +41,15 @@ public:
 
     PLQT();
 
+    PLQT(const PLQT&) = delete;
+    PLQT& operator=(const PLQT&) = delete;
+
+    /** @brief Moves the tree, leaving the source empty. */
+    PLQT(PLQT&& other) noexcept;
+
+    /** @brief Frees the current tree and takes ownership of another one. */
+    PLQT& operator=(PLQT&& other) noexcept;
+
     /**
      * @brief Destructor. Frees memory of the tree.
      */
@@ -49,6 +69,13 @@ public:
      */
     PLQTNode* search(const std::vector<int>& data) const;
 
+    /**
+     * @brief Looks up the objective value memoized for a binary vector.
+     * @param data The binary vector to look up.
+     * @return The stored cost if the vector is in the tree and has one, std::nullopt otherwise.
+     */
+    std::optional<int64_t> lookupCost(const std::vector<int>& data) const;
+
     /**
      * @brief Compares two PLQTs for deep equality.
      * @param other Another PLQT.
@@ -3,6 +3,8 @@
 
 #include <vector>
 #include <string>
+#include <cstddef>
+#include <cstdint>
 
 /**
  * @brief Represents a node in a Primogenitary Linked Quad Tree (PLQT).
@@ -16,8 +18,18 @@ public:
      */
     explicit PLQTNode(const std::vector<int>& data);
 
-    /** @brief Returns the binary data of the node. */
-    std::vector<int> getData() const;
+    /**
+     * @brief Returns a read-only view of the binary data of the node.
+     * The reference stays valid until the node is modified or destroyed,
+     * so hot loops can read the data without copying it.
+     */
+    const std::vector<int>& getData() const;
+
+    /** @brief Returns the number of components of the node's data. */
+    size_t getDimension() const;
+
+    /** @brief Returns the i-th component of the node's data without bounds checking. */
+    int getValue(size_t i) const;
 
     /** @brief Sets the binary data of the node. */
     void setData(const std::vector<int>& data);
@@ -40,12 +52,55 @@ public:
     /** @brief Sets the first child of the node. */
     void setFirstChild(PLQTNode* child);
 
-    /** @brief Returns the successor order of the node. */
+    /**
+     * @brief Returns the successor order of the node.
+     * For trees wider than 31 components this is only the low part of the
+     * order; use getSuccessorWord() or compareSuccessor() for the full key.
+     */
     int getSuccessorOrder() const;
 
-    /** @brief Sets the successor order of the node. */
+    /** @brief Sets the successor order of the node (a key of a single word). */
     void setSuccessorOrder(int order);
 
+    /**
+     * @brief Returns the w-th 64-bit word of the successor key, least significant first.
+     * Words beyond the stored key are 0.
+     */
+    uint64_t getSuccessorWord(size_t w) const;
+
+    /** @brief Returns the number of words stored for the successor key. */
+    size_t getSuccessorWordCount() const;
+
+    /**
+     * @brief Sets the full successor key.
+     * @param words Key words, least significant first.
+     * @param count Number of words.
+     */
+    void setSuccessorKey(const uint64_t* words, size_t count);
+
+    /**
+     * @brief Compares the successor key of the node with another key.
+     * @param words Key words, least significant first.
+     * @param count Number of words.
+     * @return Negative, zero or positive if the node's key is smaller, equal or greater.
+     */
+    int compareSuccessor(const uint64_t* words, size_t count) const;
+
+    /** @brief Returns true if an objective value has been stored in the node. */
+    bool hasCost() const;
+
+    /** @brief Returns the stored objective value (opening plus transport cost). */
+    int64_t getCost() const;
+
+    /** @brief Stores the evaluated objective value of the node's configuration. */
+    void setCost(int64_t cost);
+
+    /** @brief Returns the compact fingerprint of the stored assignment (0 if none). */
+    uint64_t getFingerprint() const;
+
+    /** @brief Sets the compact fingerprint of the assignment that produced the cost. */
+    void setFingerprint(uint64_t fingerprint);
+
     /**
      * @brief Compares two nodes based on their data.
      * @param other The node to compare with.
@@ -88,7 +143,13 @@ private:
     PLQTNode* parent_;
     PLQTNode* nextSibling_;
     PLQTNode* firstChild_;
-    int successorOrder_;
+    uint64_t successorOrder_;                ///< Least significant word of the successor key.
+    std::vector<uint64_t> successorHigh_;    ///< Remaining words, only used above 64 components.
+    bool hasCost_;
+    int64_t cost_;
+    uint64_t fingerprint_;
+
+    bool hasSameSuccessor(const PLQTNode& other) const;
 };
 
 #endif // PLQTNODE_H
@@ -0,0 +1,104 @@
+#ifndef PLQT_SNAPSHOT_H
+#define PLQT_SNAPSHOT_H
+
+#include "PLQT/plqt.h"
+#include "Utils/mapped_file.h"
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @class PLQTSnapshot
+ * @brief Read-only, memory-mapped view of a PLQT saved to disk.
+ *
+ * The file holds a fixed header, one record per node in pre-order (links are
+ * stored as node indices), a data block and, for trees wider than 64
+ * components, the upper words of each successor key. When every component of
+ * every node is 0 or 1 the data block is bit-packed in 64-bit words, otherwise
+ * it stores one int32 per component.
+ *
+ * Lookups run directly on the mapping. toTree() rebuilds a mutable PLQT by
+ * relinking the records, without recomputing successorships.
+ */
+class PLQTSnapshot
+{
+public:
+    /**
+     * @brief Writes a PLQT to a snapshot file.
+     * @param tree Tree to save. An empty tree is not allowed.
+     * @param path Destination file, overwritten if it exists.
+     * @param instance Fingerprint of the instance whose costs the tree memoizes
+     * (see BasicCFLPProblem::getInstanceFingerprint()), 0 if none.
+     * @throws std::invalid_argument If the tree is empty.
+     * @throws std::runtime_error If the file cannot be written.
+     */
+    static void write(const PLQT &tree, const std::string &path, uint64_t instance = 0);
+
+    /**
+     * @brief Maps and validates a snapshot file.
+     * @param path Snapshot file written by write().
+     * @throws std::runtime_error If the file is missing, truncated, not a snapshot,
+     * written in an older layout or has node links outside the file.
+     */
+    explicit PLQTSnapshot(const std::string &path);
+
+    /** @brief Returns the dimension of the stored vectors. */
+    int getDimension() const;
+
+    /** @brief Returns the number of stored nodes. */
+    size_t getNodeCount() const;
+
+    /** @brief Returns the instance fingerprint given to write(). */
+    uint64_t getInstanceFingerprint() const;
+
+    /** @brief Returns true if the vector is stored in the snapshot. */
+    bool contains(const std::vector<int> &data) const;
+
+    /** @brief Returns the cost memoized for the vector, if any. */
+    std::optional<int64_t> lookupCost(const std::vector<int> &data) const;
+
+    /** @brief Rebuilds a mutable PLQT with the same nodes, links and costs. */
+    PLQT toTree() const;
+
+private:
+    static constexpr uint32_t kNoNode = 0xFFFFFFFFu;
+
+    struct Header
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t dimension;
+        uint64_t nodeCount;
+        uint32_t packed;
+        uint32_t wordsPerNode;
+        uint64_t instance;
+    };
+
+    struct NodeRecord
+    {
+        uint32_t parent;
+        uint32_t firstChild;
+        uint32_t nextSibling;
+        uint32_t hasCost;
+        uint64_t successorLow;
+        int64_t cost;
+        uint64_t fingerprint;
+    };
+
+    MappedFile file_;
+    const Header *header_;
+    const NodeRecord *nodes_;
+    const char *data_;
+    const uint64_t *successorHigh_;
+    size_t keyWords_;
+
+    int valueAt(size_t node, size_t i) const;
+    bool matches(size_t node, const std::vector<int> &data) const;
+    void calculateSuccessorship(size_t node, const std::vector<int> &data, std::vector<uint64_t> &key) const;
+    int compareSuccessor(size_t node, const std::vector<uint64_t> &key) const;
+    uint32_t find(const std::vector<int> &data) const;
+    std::vector<int> readData(size_t node) const;
+};
+
+#endif // PLQT_SNAPSHOT_H
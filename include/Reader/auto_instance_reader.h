@@ -0,0 +1,46 @@
+#ifndef AUTOINSTANCEREADER_H
+#define AUTOINSTANCEREADER_H
+
+#include "Reader/instance_reader.h"
+
+using namespace std;
+
+/**
+ * @brief Reader that detects the format of each file and delegates to the matching reader.
+ *
+ * Handles the Beasley, Holmberg, Yang and TBED text formats and the binary
+ * format; see detectInstanceFormat() for how they are told apart.
+ */
+class AutoInstanceReader : public InstanceReader {
+public:
+    /**
+     * @brief Constructs a reader.
+     * @param placeholderCapacity Passed to BeasleyInstanceReader for the "capacity" placeholder.
+     */
+    explicit AutoInstanceReader(int placeholderCapacity = 0);
+
+    /**
+     * @brief Reads an instance from a file in any supported format.
+     * 
+     * @param filename The name of the file containing the instance data.
+     * @return Instance The read instance.
+     * @throws runtime_error If the format is not recognised or the file is malformed.
+     */
+    CFLPProblem readInstance(const string& filename) const override;
+
+    /**
+     * @brief Reads an instance in any supported format with the given cost type.
+     *
+     * @tparam Cost int32_t, int64_t (fixed point) or double.
+     * @param filename The name of the file containing the instance data.
+     * @return The read instance.
+     * @throws runtime_error If the format is not recognised or the file is malformed.
+     */
+    template <typename Cost>
+    BasicCFLPProblem<Cost> readInstanceAs(const string& filename) const;
+
+private:
+    int placeholderCapacity_;
+};
+
+#endif // AUTOINSTANCEREADER_H
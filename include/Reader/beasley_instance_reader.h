@@ -2,22 +2,77 @@
 #define BEASLEYINSTANCEREADER_H
 
 #include "Reader/instance_reader.h"
+#include "Reader/sparse_instance.h"
 #include <vector>
 
 using namespace std;
 
+class TextScanner;
+
 /**
  * @brief Class for reading Beasley instances of the Capacitated Facility Location Problem.
+ *
+ * The file is memory-mapped and parsed with std::from_chars. Each facility line
+ * holds either a numeric capacity or the word "capacity" (capa, capb and capc),
+ * which stands for a capacity chosen when the instance is used.
+ * readInstance() truncates fractional transportation costs to integers;
+ * readInstanceAs() converts them with CostTraits of the chosen cost type.
  */
 class BeasleyInstanceReader : public InstanceReader {
 public:
+    /**
+     * @brief Constructs a reader.
+     * @param placeholderCapacity Capacity used for the "capacity" placeholder.
+     * If 0, the first capacity listed by OR-Library for the file is used
+     * (capa: 8000, capb: 5000, capc: 5000).
+     */
+    explicit BeasleyInstanceReader(int placeholderCapacity = 0);
+
     /**
      * @brief Reads an instance from a file.
      * 
      * @param filename The name of the file containing the instance data.
      * @return Instance The read instance.
+     * @throws runtime_error If the file cannot be read or is malformed; the
+     * message gives the file name and line.
      */
     CFLPProblem readInstance(const string& filename) const override;
+
+    /**
+     * @brief Reads an instance from a file with the given cost type.
+     *
+     * @tparam Cost int32_t, int64_t (fixed point) or double.
+     * @param filename The name of the file containing the instance data.
+     * @return The read instance, with costs converted by CostTraits<Cost>::fromDecimal.
+     * @throws runtime_error If the file cannot be read or is malformed.
+     */
+    template <typename Cost>
+    BasicCFLPProblem<Cost> readInstanceAs(const string& filename) const;
+
+    /**
+     * @brief Streams an instance into a sparse cost matrix.
+     *
+     * Customers are read one at a time and only their `neighbors` cheapest
+     * facilities are kept, so memory grows with customers x neighbors instead
+     * of facilities x customers. The matrix gets a column loader that re-reads
+     * the cost block of a customer from the file, which must stay in place
+     * while the matrix is used.
+     *
+     * @tparam Cost int32_t, int64_t (fixed point) or double.
+     * @param filename The name of the file containing the instance data.
+     * @param neighbors Number of cheapest facilities kept per customer.
+     * @return The read instance.
+     * @throws runtime_error If the file cannot be read or is malformed.
+     */
+    template <typename Cost>
+    BasicSparseInstance<Cost> readSparseInstanceAs(const string& filename, size_t neighbors) const;
+
+private:
+    int placeholderCapacity_;
+
+    int resolvePlaceholderCapacity(const string& filename) const;
+    void readFacilities(TextScanner& scanner, const string& filename,
+                        vector<int>& capacities, vector<double>& openingCosts) const;
 };
 
 #endif // BEASLEYINSTANCEREADER_H
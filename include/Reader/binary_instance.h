@@ -0,0 +1,143 @@
+#ifndef BINARY_INSTANCE_H
+#define BINARY_INSTANCE_H
+
+#include "CapacitatedFacilityLocationProblem/cflp_problem.h"
+#include "Utils/mapped_file.h"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * @class BinaryInstance
+ * @brief Read-only, memory-mapped view of a CFLP instance in binary form.
+ *
+ * The file holds a fixed 64-byte header followed by four blocks, each
+ * starting on a 64-byte boundary: capacities (int32), demands (int32),
+ * opening costs (float64) and the cost matrix (float64, one row of customers
+ * per facility). Costs are stored in cost units as read, decimals included,
+ * and converted with CostTraits when an instance is loaded. Values are stored
+ * in host byte order. The accessors return pointers into the mapping, so
+ * nothing is parsed or copied on load.
+ */
+class BinaryInstance
+{
+public:
+    /// Extension used for binary instance files.
+    static constexpr const char *kExtension = ".cflpb";
+
+    /**
+     * @brief Writes an instance in binary form.
+     * @tparam Cost int32_t, int64_t (fixed point, stored in cost units) or double.
+     * @param problem Instance to save.
+     * @param path Destination file, overwritten if it exists.
+     * @throws std::runtime_error If the file cannot be written.
+     */
+    template <typename Cost>
+    static void write(const BasicCFLPProblem<Cost> &problem, const std::string &path);
+
+    /**
+     * @class Writer
+     * @brief Writes a binary instance whose cost rows are produced a few at a time.
+     *
+     * The header and the facility and customer blocks are written on
+     * construction; cost rows are then appended in facility order, so the
+     * full matrix never has to be in memory.
+     */
+    class Writer
+    {
+    public:
+        /**
+         * @brief Opens the file and writes everything but the cost matrix.
+         * @param path Destination file, overwritten if it exists.
+         * @throws std::runtime_error If the file cannot be written.
+         */
+        Writer(const std::string &path, const std::vector<int> &capacities, const std::vector<int> &demands,
+               const std::vector<double> &openingCosts);
+
+        /**
+         * @brief Appends consecutive cost rows.
+         * @param values rows * customers costs, one row per facility.
+         * @param rows Number of rows in values.
+         * @throws std::logic_error If more rows than facilities are appended.
+         */
+        void appendCostRows(const double *values, size_t rows);
+
+        /**
+         * @brief Flushes and closes the file.
+         * @throws std::logic_error If some cost rows are missing.
+         * @throws std::runtime_error If the file cannot be written.
+         */
+        void finish();
+
+    private:
+        std::string path_;
+        std::ofstream out_;
+        uint64_t facilities_;
+        uint64_t customers_;
+        uint64_t rowsWritten_ = 0;
+    };
+
+    /**
+     * @brief Maps and validates a binary instance file.
+     * @param path File written by write().
+     * @throws std::runtime_error If the file is missing, truncated, not a binary instance
+     * or written in an older layout (version 1 stored int32 costs).
+     */
+    explicit BinaryInstance(const std::string &path);
+
+    /** @brief Returns the number of facilities. */
+    size_t getFacilityCount() const;
+
+    /** @brief Returns the number of customers. */
+    size_t getCustomerCount() const;
+
+    /** @brief Returns the facility capacities (getFacilityCount() values). */
+    const int32_t *getCapacities() const;
+
+    /** @brief Returns the customer demands (getCustomerCount() values). */
+    const int32_t *getDemands() const;
+
+    /** @brief Returns the facility opening costs (getFacilityCount() values). */
+    const double *getOpeningCosts() const;
+
+    /**
+     * @brief Returns the transportation costs from a facility to every customer.
+     * @param facility Index of the facility.
+     */
+    const double *getCostRow(size_t facility) const;
+
+    /** @brief Copies the instance into a CFLPProblem, truncating the costs. */
+    CFLPProblem toProblem() const;
+
+    /**
+     * @brief Copies the instance converting its costs with CostTraits<Cost>::fromDecimal.
+     * @tparam Cost int32_t, int64_t (fixed point) or double.
+     */
+    template <typename Cost>
+    BasicCFLPProblem<Cost> toProblemAs() const;
+
+private:
+    struct Header
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t headerSize;
+        uint64_t facilities;
+        uint64_t customers;
+        uint64_t capacitiesOffset;
+        uint64_t demandsOffset;
+        uint64_t openingCostsOffset;
+        uint64_t costsOffset;
+    };
+
+    static_assert(sizeof(Header) == 64, "BinaryInstance header must be 64 bytes");
+
+    MappedFile file_;
+    const Header *header_;
+
+    template <typename T>
+    const T *block(uint64_t offset) const;
+};
+
+#endif // BINARY_INSTANCE_H
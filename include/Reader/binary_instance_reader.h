@@ -0,0 +1,38 @@
+#ifndef BINARYINSTANCEREADER_H
+#define BINARYINSTANCEREADER_H
+
+#include "Reader/instance_reader.h"
+
+using namespace std;
+
+/**
+ * @brief Class for reading instances stored in the binary format of BinaryInstance.
+ *
+ * Loading maps the file and copies each block in bulk; there is no text
+ * parsing. Callers that only need to inspect the data can use BinaryInstance
+ * directly and avoid the copy.
+ */
+class BinaryInstanceReader : public InstanceReader {
+public:
+    /**
+     * @brief Reads an instance from a binary file.
+     * 
+     * @param filename The name of the file containing the instance data.
+     * @return Instance The read instance.
+     * @throws runtime_error If the file is missing or is not a valid binary instance.
+     */
+    CFLPProblem readInstance(const string& filename) const override;
+
+    /**
+     * @brief Reads an instance from a binary file with the given cost type.
+     *
+     * @tparam Cost int32_t, int64_t (fixed point) or double.
+     * @param filename The name of the file containing the instance data.
+     * @return The read instance, with costs converted by CostTraits<Cost>::fromDecimal.
+     * @throws runtime_error If the file is missing or is not a valid binary instance.
+     */
+    template <typename Cost>
+    BasicCFLPProblem<Cost> readInstanceAs(const string& filename) const;
+};
+
+#endif // BINARYINSTANCEREADER_H
@@ -0,0 +1,87 @@
+#ifndef INSTANCEBATCHLOADER_H
+#define INSTANCEBATCHLOADER_H
+
+#include "CapacitatedFacilityLocationProblem/cflp_problem.h"
+#include <atomic>
+#include <functional>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Loads a set of instance files concurrently on a pool of threads.
+ *
+ * Files are sorted by path and handed to the workers in that order, so the
+ * first instances are ready first and a solver can start on them while the
+ * rest are still being parsed. Each instance is delivered through its own
+ * future; a file that fails to load makes get() rethrow its error without
+ * affecting the others.
+ */
+class InstanceBatchLoader {
+public:
+    /// Function that loads one file; the default detects the format with AutoInstanceReader.
+    using Loader = function<CFLPProblem(const string&)>;
+
+    /**
+     * @brief Lists the files matched by a directory or a glob pattern, sorted by path.
+     *
+     * A directory yields every regular file in it, except hidden ones. Any
+     * other argument is a pattern whose last component may use the
+     * wildcards * and ? (for example "instances/Beasley/cap1*.txt").
+     * @throws runtime_error If the directory of the pattern does not exist.
+     */
+    static vector<string> listFiles(const string& directoryOrPattern);
+
+    /**
+     * @brief Starts loading the given files.
+     * @param paths Files to load, sorted by the loader.
+     * @param threads Number of worker threads; 0 uses all cores.
+     * @param loader Function that loads one file.
+     */
+    explicit InstanceBatchLoader(vector<string> paths, unsigned threads = 0, Loader loader = nullptr);
+
+    /**
+     * @brief Starts loading the files of a directory or glob pattern (see listFiles()).
+     */
+    explicit InstanceBatchLoader(const string& directoryOrPattern, unsigned threads = 0, Loader loader = nullptr);
+
+    InstanceBatchLoader(const InstanceBatchLoader&) = delete;
+    InstanceBatchLoader& operator=(const InstanceBatchLoader&) = delete;
+
+    /**
+     * @brief Skips the files not yet started and waits for the workers.
+     */
+    ~InstanceBatchLoader();
+
+    /** @brief Returns the number of files. */
+    size_t size() const;
+
+    /** @brief Returns the path of the index-th file, in sorted order. */
+    const string& getPath(size_t index) const;
+
+    /** @brief Returns true once the index-th file has been loaded or has failed. */
+    bool isReady(size_t index) const;
+
+    /**
+     * @brief Waits for the index-th instance and takes it.
+     * @throws The error raised while loading the file.
+     * @throws future_error If the instance was already taken.
+     */
+    CFLPProblem get(size_t index);
+
+private:
+    vector<string> paths_;
+    Loader loader_;
+    vector<promise<CFLPProblem>> promises_;
+    vector<future<CFLPProblem>> futures_;
+    atomic<size_t> next_{0};
+    vector<thread> workers_;
+
+    void start(unsigned threads);
+    void work();
+};
+
+#endif // INSTANCEBATCHLOADER_H
@@ -0,0 +1,63 @@
+#ifndef INSTANCEFORMAT_H
+#define INSTANCEFORMAT_H
+
+#include <string>
+
+using namespace std;
+
+/**
+ * @brief File formats of CFLP instances.
+ *
+ * All text formats start with the numbers of facilities m and customers n
+ * and differ in the order of the remaining blocks:
+ *
+ * - Beasley (OR-Library): m lines "capacity opening-cost", then for each
+ *   customer its demand followed by its m costs.
+ * - Holmberg: m lines "capacity opening-cost", the n demands, then one row
+ *   of n costs per facility.
+ * - Yang: m lines "capacity opening-cost", the n demands, then one row of m
+ *   costs per customer.
+ * - TBED (Avella and Boccia): the n demands, the m capacities, the m
+ *   opening costs, then one row of n costs per facility.
+ *
+ * Costs are the cost of serving all the demand of a customer, as in the
+ * Beasley files. The Holmberg, Yang and TBED layouts are those of the files
+ * as usually redistributed; sets that differ need their own reader.
+ */
+enum class InstanceFormat {
+    Beasley,
+    Holmberg,
+    Yang,
+    Tbed,
+    Binary
+};
+
+/**
+ * @brief Returns the name of a format ("beasley", "holmberg", "yang", "tbed" or "binary").
+ */
+string toString(InstanceFormat format);
+
+/**
+ * @brief Detects the format of an instance from its content.
+ *
+ * Binary files are recognised by their magic number. Text formats are told
+ * apart by the number of tokens on each line: a second line with other than
+ * two tokens is TBED; a lone demand followed by a line of costs is Beasley;
+ * otherwise the cost rows after the demands hold n values (Holmberg) or m
+ * values (Yang). When the line shapes are ambiguous (m = n, or rows wrapped
+ * over several lines) Holmberg is assumed.
+ *
+ * @param begin First character of the file.
+ * @param end One past the last character of the file.
+ * @param source Name used in error messages.
+ * @throws runtime_error If the content does not start with the two sizes.
+ */
+InstanceFormat detectInstanceFormat(const char* begin, const char* end, const string& source);
+
+/**
+ * @brief Maps a file and detects its format.
+ * @throws runtime_error If the file cannot be read or has no recognisable format.
+ */
+InstanceFormat detectInstanceFormat(const string& filename);
+
+#endif // INSTANCEFORMAT_H
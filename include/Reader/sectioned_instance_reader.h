@@ -0,0 +1,75 @@
+#ifndef SECTIONEDINSTANCEREADER_H
+#define SECTIONEDINSTANCEREADER_H
+
+#include "Reader/instance_format.h"
+#include "Reader/instance_reader.h"
+
+using namespace std;
+
+/**
+ * @brief Reader for the text formats that list each block of data in one piece.
+ *
+ * Covers the Holmberg, Yang and TBED layouts described in InstanceFormat.
+ * Files are memory-mapped and parsed with the same TextScanner as
+ * BeasleyInstanceReader; readInstance() truncates fractional costs to
+ * integers and readInstanceAs() converts them with CostTraits.
+ */
+class SectionedInstanceReader : public InstanceReader {
+public:
+    /**
+     * @brief Reads an instance from a file.
+     *
+     * @param filename The name of the file containing the instance data.
+     * @return Instance The read instance.
+     * @throws runtime_error If the file cannot be read or is malformed; the
+     * message gives the file name and line.
+     */
+    CFLPProblem readInstance(const string& filename) const override;
+
+    /**
+     * @brief Reads an instance from a file with the given cost type.
+     *
+     * @tparam Cost int32_t, int64_t (fixed point) or double.
+     * @param filename The name of the file containing the instance data.
+     * @return The read instance, with costs converted by CostTraits<Cost>::fromDecimal.
+     * @throws runtime_error If the file cannot be read or is malformed.
+     */
+    template <typename Cost>
+    BasicCFLPProblem<Cost> readInstanceAs(const string& filename) const;
+
+protected:
+    /**
+     * @brief Constructs a reader for one layout.
+     * @param format InstanceFormat::Holmberg, InstanceFormat::Yang or InstanceFormat::Tbed.
+     */
+    explicit SectionedInstanceReader(InstanceFormat format);
+
+private:
+    InstanceFormat format_;
+};
+
+/**
+ * @brief Reads Holmberg instances (p1-p71): facility pairs, demands, facility-major costs.
+ */
+class HolmbergInstanceReader : public SectionedInstanceReader {
+public:
+    HolmbergInstanceReader();
+};
+
+/**
+ * @brief Reads Yang instances: facility pairs, demands, customer-major costs.
+ */
+class YangInstanceReader : public SectionedInstanceReader {
+public:
+    YangInstanceReader();
+};
+
+/**
+ * @brief Reads TBED instances (Avella and Boccia): demands, capacities, opening costs, facility-major costs.
+ */
+class TbedInstanceReader : public SectionedInstanceReader {
+public:
+    TbedInstanceReader();
+};
+
+#endif // SECTIONEDINSTANCEREADER_H
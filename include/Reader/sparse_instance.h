@@ -0,0 +1,25 @@
+#ifndef SPARSE_INSTANCE_H
+#define SPARSE_INSTANCE_H
+
+#include "TransportProblem/sparse_cost_matrix.h"
+#include <vector>
+
+/**
+ * @brief CFLP instance whose transportation costs are kept in sparse form.
+ *
+ * The costs feed BasicCFLPTransportSubproblem through its sparse constructor.
+ * @tparam Cost Type of the unit transportation costs (see CostTraits).
+ */
+template <typename Cost>
+struct BasicSparseInstance
+{
+    std::vector<int> capacities;     ///< Capacity of each facility.
+    std::vector<int> demands;        ///< Demand of each customer.
+    std::vector<double> openingCosts; ///< Opening cost of each facility.
+    BasicSparseCostMatrix<Cost> costs; ///< k cheapest facilities of each customer.
+};
+
+/// Sparse instance with integer costs.
+using SparseInstance = BasicSparseInstance<int>;
+
+#endif // SPARSE_INSTANCE_H
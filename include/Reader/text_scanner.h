@@ -0,0 +1,76 @@
+#ifndef TEXT_SCANNER_H
+#define TEXT_SCANNER_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * @class TextScanner
+ * @brief Locale-independent tokenizer over an in-memory text buffer.
+ *
+ * Numbers are parsed with std::from_chars directly from the buffer (usually a
+ * MappedFile), without copying tokens. The scanner tracks the current line so
+ * that malformed input is reported as "<source>:<line>: <message>".
+ */
+class TextScanner
+{
+public:
+    /**
+     * @brief Creates a scanner over [begin, end).
+     * @param begin First character of the buffer.
+     * @param end One past the last character of the buffer.
+     * @param source Name used in error messages (usually the file name).
+     * @param line Line number of begin, for scanners resumed mid-file.
+     */
+    TextScanner(const char *begin, const char *end, std::string source, size_t line = 1);
+
+    /** @brief Skips whitespace and returns true if no token is left. */
+    bool atEnd();
+
+    /** @brief Returns the line of the next token (1-based). */
+    size_t line();
+
+    /** @brief Skips whitespace and returns a pointer to the next token. */
+    const char *position();
+
+    /** @brief Returns the next token without consuming it (empty at the end). */
+    std::string_view peekToken();
+
+    /**
+     * @brief Consumes the next token if it equals the given word.
+     * @return true if the word was consumed.
+     */
+    bool consumeWord(std::string_view word);
+
+    /**
+     * @brief Parses the next token as an integer.
+     * @param what Description of the expected value, used in error messages.
+     * @throws std::runtime_error If the token is missing or not an integer; the token is then left unconsumed.
+     */
+    long long nextInteger(const char *what);
+
+    /**
+     * @brief Parses the next token as a decimal number.
+     * @param what Description of the expected value, used in error messages.
+     * @throws std::runtime_error If the token is missing or not a number.
+     */
+    double nextDouble(const char *what);
+
+    /** @brief Throws std::runtime_error with the source name and current line. */
+    [[noreturn]] void fail(const std::string &message);
+
+    /** @brief Returns the name given to the scanner. */
+    const std::string &source() const;
+
+private:
+    const char *current_;
+    const char *end_;
+    std::string source_;
+    size_t line_;
+
+    void skipWhitespace();
+    std::string_view requireToken(const char *what);
+};
+
+#endif // TEXT_SCANNER_H
@@ -0,0 +1,83 @@
+#ifndef CONCURRENT_VISITED_SET_H
+#define CONCURRENT_VISITED_SET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class ConcurrentVisitedSet
+ * @brief Visited-configuration memory that several tabu workers can share.
+ *
+ * Configurations are bit-packed and spread over independent shards by hash.
+ * Each shard has its own reader/writer lock, so probes only contend with
+ * inserts that land in the same shard and there is no global lock.
+ * Entries are never removed.
+ */
+class ConcurrentVisitedSet
+{
+public:
+    /**
+     * @brief Constructs an empty set.
+     * @param dimension Length of the binary vectors (number of facilities).
+     * @param shardCount Number of shards, rounded up to a power of two.
+     * @throws std::invalid_argument If dimension or shardCount is not positive.
+     */
+    explicit ConcurrentVisitedSet(int dimension, size_t shardCount = 64);
+
+    /**
+     * @brief Inserts a configuration.
+     * @param data Binary vector of the configuration.
+     * @return true if the configuration was not in the set.
+     */
+    bool insert(const std::vector<int> &data);
+
+    /**
+     * @brief Inserts a configuration together with its objective value.
+     * An already stored cost is kept.
+     * @param data Binary vector of the configuration.
+     * @param cost Evaluated objective of the configuration.
+     * @return true if the configuration was not in the set.
+     */
+    bool insert(const std::vector<int> &data, int64_t cost);
+
+    /** @brief Returns true if the configuration has been inserted by any worker. */
+    bool contains(const std::vector<int> &data) const;
+
+    /** @brief Returns the cost stored with the configuration, if any. */
+    std::optional<int64_t> lookupCost(const std::vector<int> &data) const;
+
+    /** @brief Returns the number of stored configurations. */
+    size_t size() const;
+
+    /** @brief Returns the dimension of the stored vectors. */
+    int getDimension() const;
+
+private:
+    struct Entry
+    {
+        bool hasCost;
+        int64_t cost;
+    };
+
+    struct Shard
+    {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::string, Entry> entries;
+    };
+
+    int dimension_;
+    size_t shardMask_;
+    std::unique_ptr<Shard[]> shards_;
+
+    std::string pack(const std::vector<int> &data) const;
+    Shard &shardFor(const std::string &key) const;
+    bool insertEntry(const std::vector<int> &data, Entry entry);
+};
+
+#endif // CONCURRENT_VISITED_SET_H
@@ -0,0 +1,122 @@
+#ifndef CONVERGENCE_TRACE_H
+#define CONVERGENCE_TRACE_H
+
+#include "Utils/spsc_ring_buffer.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+
+/**
+ * @brief One executed move of the tabu search.
+ */
+struct TraceEvent
+{
+    int32_t iteration = 0; ///< Value of k after the move.
+    int32_t facility = -1; ///< Facility toggled by the move.
+    int64_t zk = 0;        ///< Cost after the move.
+    int64_t z0 = 0;        ///< Best cost of the current cycle after the move.
+    int64_t z00 = 0;       ///< Best cost overall after the move.
+    bool opened = false;   ///< Whether the move opened the facility (else it closed it).
+    bool tabu = false;     ///< Whether the facility was tabu when it was moved.
+};
+
+/**
+ * @class ConvergenceTrace
+ * @brief Records the moves of a solve in a preallocated ring buffer.
+ *
+ * The solver is the only producer and records without allocating or
+ * locking; a single consumer (writeCsv() after the solve, or a TraceDumper
+ * while it runs) drains the events. If the consumer falls behind and the
+ * buffer fills, new events are dropped and counted rather than blocking
+ * the search.
+ */
+class ConvergenceTrace
+{
+public:
+    /**
+     * @param capacity Number of events buffered between drains (rounded up to a power of two).
+     */
+    explicit ConvergenceTrace(size_t capacity = 1 << 16);
+
+    /** @brief Records an event. Solver thread only. */
+    void record(const TraceEvent &event)
+    {
+        if (!buffer_.push(event))
+        {
+            dropped_.store(dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Pops every buffered event and passes it to sink. Consumer thread only.
+     * @return Number of events popped.
+     */
+    template <typename Sink>
+    size_t drain(Sink sink)
+    {
+        return buffer_.drain(sink);
+    }
+
+    /** @brief Writes the CSV header of writeCsv(). */
+    static void writeCsvHeader(std::ostream &out);
+
+    /**
+     * @brief Drains the buffered events as CSV rows. Consumer thread only.
+     * @return Number of rows written.
+     */
+    size_t writeCsv(std::ostream &out);
+
+    /** @brief Number of events dropped because the buffer was full. */
+    uint64_t getDropped() const;
+
+    /** @brief Number of buffer slots. */
+    size_t getCapacity() const;
+
+private:
+    SpscRingBuffer<TraceEvent> buffer_;
+    std::atomic<uint64_t> dropped_{0};
+};
+
+/**
+ * @class TraceDumper
+ * @brief Drains a ConvergenceTrace into a CSV file from a background thread.
+ *
+ * The file is written by the dumper's thread, so the solve only pays for
+ * recording. The destructor stops the thread and writes what is left.
+ */
+class TraceDumper
+{
+public:
+    /**
+     * @param trace Trace to drain; it must outlive the dumper.
+     * @param path Destination CSV file.
+     * @param interval Time between drains.
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    TraceDumper(ConvergenceTrace &trace, const std::string &path,
+                std::chrono::milliseconds interval = std::chrono::milliseconds(10));
+    ~TraceDumper();
+
+    TraceDumper(const TraceDumper &) = delete;
+    TraceDumper &operator=(const TraceDumper &) = delete;
+
+private:
+    void run();
+
+    ConvergenceTrace &trace_;
+    std::ofstream out_;
+    std::chrono::milliseconds interval_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+    std::thread worker_;
+};
+
+#endif // CONVERGENCE_TRACE_H
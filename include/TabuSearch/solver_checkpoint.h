@@ -0,0 +1,128 @@
+#ifndef SOLVER_CHECKPOINT_H
+#define SOLVER_CHECKPOINT_H
+
+#include "PLQT/plqt.h"
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Search state of a TabuSearchSolver at a move boundary.
+ *
+ * Besides the vectors and counters of the search it holds the generator
+ * of the tabu tenures, the elite solutions of the P2 and P3 priorities
+ * and every configuration of the tabu memory with its memoized cost.
+ *
+ * The file starts with the magic "CFLPCKPT", a version, the instance
+ * sizes and fingerprint, then the scalars, the 0/1 vectors bit-packed in 64-bit words,
+ * t and h as int32 and the memory nodes in pre-order; it ends with the
+ * magic again so a truncated file is rejected.
+ */
+struct SolverCheckpoint
+{
+    /// Configuración de la memoria tabú con su costo memorizado
+    struct MemoryNode
+    {
+        std::vector<uint64_t> bits;
+        bool hasCost = false;
+        int64_t cost = 0;
+        uint64_t fingerprint = 0;
+    };
+
+    uint32_t facilities = 0;
+    uint32_t customers = 0;
+    uint64_t instance = 0;   ///< Instance fingerprint (see BasicCFLPProblem::getInstanceFingerprint()).
+    int32_t k = 1, k0 = 1, c = 1, c0 = 0;
+    int32_t l0 = 0, l1 = 0;
+    int64_t z0 = 0, zk = 0, z00 = 0;
+    double elapsed = 0.0;    ///< Seconds of search before the checkpoint.
+    double timeToBest = 0.0; ///< Seconds until the best solution was found.
+    std::string generator;   ///< State of the std::mt19937, as written by operator<<.
+    std::vector<int> y, yBest, yP2, yP3, t, h;
+    std::vector<MemoryNode> memory;
+
+    /**
+     * @brief Copies the nodes of a tabu memory in pre-order.
+     * @throws std::invalid_argument If a node holds a value other than 0 or 1.
+     */
+    static std::vector<MemoryNode> captureMemory(const PLQT &tree);
+
+    /** @brief Rebuilds a tabu memory from captured nodes. */
+    PLQT restoreMemory() const;
+
+    /**
+     * @brief Writes the checkpoint to a temporary file and renames it over path,
+     * so an interrupted write never replaces a good checkpoint.
+     * @throws std::runtime_error If the file cannot be written.
+     */
+    void write(const std::string &path) const;
+
+    /**
+     * @brief Reads a checkpoint file.
+     * Every count read from the file is checked against the bytes left in it,
+     * so a corrupt file is rejected before anything is allocated for it.
+     * @throws std::runtime_error If the file is missing, truncated or not a checkpoint.
+     */
+    static SolverCheckpoint read(const std::string &path);
+};
+
+/**
+ * @class CheckpointWriter
+ * @brief Writes checkpoints from a background thread.
+ *
+ * The solver only pays for copying its state; serialization and disk I/O
+ * happen on the writer's thread. One checkpoint is written at a time:
+ * submit() refuses a new one while the previous is still being written,
+ * so a slow disk skips checkpoints instead of stalling the search.
+ */
+class CheckpointWriter
+{
+public:
+    CheckpointWriter();
+
+    /** @brief Finishes the checkpoint in progress, then stops the thread. */
+    ~CheckpointWriter();
+
+    CheckpointWriter(const CheckpointWriter &) = delete;
+    CheckpointWriter &operator=(const CheckpointWriter &) = delete;
+
+    /**
+     * @brief Returns true if a checkpoint can be submitted now.
+     * Lets the caller skip copying its state when the writer is busy.
+     */
+    bool isIdle();
+
+    /**
+     * @brief Queues a checkpoint to be written to path.
+     * @return false if the previous checkpoint is still being written; the new one is dropped.
+     */
+    bool submit(SolverCheckpoint checkpoint, const std::string &path);
+
+    /**
+     * @brief Waits until the submitted checkpoint has been written.
+     * @throws std::runtime_error If writing it failed.
+     */
+    void wait();
+
+    /** @brief Number of checkpoints written. */
+    size_t getWrittenCount();
+
+private:
+    void run();
+
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    std::optional<SolverCheckpoint> pending_;
+    std::string path_;
+    bool busy_ = false;
+    bool stop_ = false;
+    size_t written_ = 0;
+    std::string error_;
+    std::thread worker_;
+};
+
+#endif // SOLVER_CHECKPOINT_H
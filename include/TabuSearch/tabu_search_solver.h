@@ -1,15 +1,24 @@
 #pragma once
 
 #include "CapacitatedFacilityLocationProblem/cflp_problem.h"
+#include "CapacitatedFacilityLocationProblem/cflp_solution.h"
 #include "TransportProblem/transport_problem.h"
-#include "TransportProblem/transport_problem.h"
-#include "TabuSearch/tabu_search_solver.h"
 #include "PLQT/plqt.h"
+#include "TabuSearch/concurrent_visited_set.h"
+#include "TabuSearch/convergence_trace.h"
+#include "TabuSearch/solver_checkpoint.h"
+#include "Utils/instrumentation.h"
+#include "Utils/memory_accounting.h"
+#include <chrono>
+#include <cstdint>
 #include <vector>
 #include <unordered_set>
 #include <unordered_map>
 #include <limits>
+#include <memory>
+#include <optional>
 #include <random>
+#include <string>
 
 class TabuSearchSolver
 {
@@ -20,18 +29,171 @@ public:
     std::vector<int> getBestSolution() const;
     double getBestCost() const;
 
+    /**
+     * @brief Returns the tabu memory, whose nodes also memoize the cost of
+     * every visited configuration.
+     */
+    const PLQT &getMemory() const;
+
+    /**
+     * @brief Shares a visited-configuration memory with other solvers.
+     *
+     * Every executed move is published to the shared set, and the reconciling,
+     * path relinking and diversification phases skip configurations that any
+     * worker has visited. The set must outlive the solve.
+     * @param shared Set shared by the workers, or nullptr to search alone.
+     * @throws std::invalid_argument If the set dimension differs from the instance.
+     */
+    void setSharedMemory(ConcurrentVisitedSet *shared);
+
+    /**
+     * @brief Records every executed move in a convergence trace.
+     * Recording does not allocate; the trace must outlive the solve.
+     * @param trace Trace to fill, or nullptr to stop recording.
+     */
+    void setTrace(ConvergenceTrace *trace);
+
+    /**
+     * @brief Saves the tabu memory to a snapshot file (see PLQTSnapshot).
+     * @param path Destination file.
+     */
+    void saveMemory(const std::string &path) const;
+
+    /**
+     * @brief Restores the tabu memory from a snapshot file.
+     * The next solve() keeps the restored memory instead of starting a new one,
+     * so configurations visited before a restart are still tabu and cached.
+     * @param path Snapshot file written by saveMemory().
+     * @throws std::invalid_argument If the snapshot was written for another instance.
+     */
+    void restoreMemory(const std::string &path);
+
+    /**
+     * @brief Returns the full search state: vectors, counters, generator and tabu memory.
+     * Only consistent between moves, i.e. before or after solve() or from a checkpoint taken by the solver.
+     */
+    SolverCheckpoint getCheckpoint() const;
+
+    /**
+     * @brief Writes getCheckpoint() to a file (see SolverCheckpoint).
+     * @param path Destination file.
+     */
+    void saveCheckpoint(const std::string &path) const;
+
+    /**
+     * @brief Writes a checkpoint during solve() every given number of seconds.
+     *
+     * The state is copied after a move and written by a background thread,
+     * so the search only pauses for the copy; a checkpoint falling due while
+     * the previous one is still being written is skipped. The last one is
+     * flushed before solve() returns.
+     * @param path Checkpoint file, replaced on each write.
+     * @param intervalSeconds Seconds between checkpoints; 0 checkpoints after every move.
+     * @throws std::invalid_argument If the interval is negative.
+     */
+    void enableCheckpoints(const std::string &path, double intervalSeconds);
+
+    /**
+     * @brief Makes the next solve() continue from a checkpoint instead of starting over.
+     *
+     * The search resumes at the move boundary where the checkpoint was taken,
+     * with the same counters, tenures, generator and tabu memory, and the
+     * elapsed time counts against the time limit. The phase the search was in
+     * is not saved: the resumed search restarts from the main search process.
+     * @param path Checkpoint file written by saveCheckpoint() or enableCheckpoints().
+     * @throws std::invalid_argument If the checkpoint was written for another instance.
+     * @throws std::runtime_error If the file cannot be read or its generator state is invalid.
+     */
+    void resume(const std::string &path);
+
+    /**
+     * @brief Seeds the generator of the tabu tenures (12345 by default).
+     */
+    void setSeed(unsigned seed);
+
+    /**
+     * @brief Stops the search once solve() has run for the given time.
+     * @param seconds Wall-clock limit; 0 for no limit.
+     */
+    void setTimeLimit(double seconds);
+
+    /** @brief Returns the number of moves executed so far. */
+    int getIterationCount() const;
+
+    /** @brief Returns the seconds from the start of the last solve() until its best solution was found. */
+    double getTimeToBest() const;
+
+    /**
+     * @brief Returns the counters and phase times recorded during the last solve().
+     * All zero unless built with CFLP_INSTRUMENTATION (see Utils/instrumentation.h).
+     */
+    const Instrumentation::Report &getInstrumentation() const;
+
+    /**
+     * @brief Writes the report of getInstrumentation() as JSON.
+     * @param path Destination file.
+     */
+    void writeInstrumentation(const std::string &path) const;
+
+    /**
+     * @brief Returns the heap usage of the last solve() per subsystem.
+     * All zero unless built with CFLP_ALLOCATION_TRACKING (see Utils/memory_accounting.h).
+     */
+    const MemoryAccounting::Report &getMemoryUsage() const;
+
+    /**
+     * @brief Starts the next solve() from the given configuration instead of
+     * the greedy one built from the P3 priorities.
+     *
+     * If the configuration cannot cover the total demand, facilities are
+     * opened in P3 priority order until it does.
+     * @param open Status of each facility (1 open, 0 closed).
+     * @throws std::invalid_argument If the size differs from the instance or a status is not 0 or 1.
+     */
+    void setInitialSolution(const std::vector<int> &open);
+
+    /**
+     * @brief Starts the next solve() from a solution file written by saveSolution().
+     * @param path Solution file (see CFLPSolution).
+     * @throws std::invalid_argument If the solution has other sizes than the instance.
+     */
+    void warmStart(const std::string &path);
+
+    /**
+     * @brief Returns the best solution found, evaluated on the problem.
+     * @param withAssignments Whether to include the assignment matrix.
+     */
+    CFLPSolution getSolution(bool withAssignments = false);
+
+    /**
+     * @brief Saves the best solution found to a file (see CFLPSolution).
+     * @param path Destination file.
+     * @param withAssignments Whether to include the assignment matrix.
+     */
+    void saveSolution(const std::string &path, bool withAssignments = false);
+
 private:
     // Referencia al problema
     CFLPProblem &problem;
 
     // Parámetros de búsqueda tabú
-    int alpha1 = 1;
-    int alpha2 = 0.5;
+    double alpha1 = 1;
+    double alpha2 = 0.5;
     int C = 10;
     int bar_m = 30;
     int l0_l = 10, l0_u = 15;
     int l1_l = 10, l1_u = 15;
     int l0 = 0, l1 = 0;
+    int maxIterations;        // límite de movimientos (k) para cortar la recursión
+    std::mt19937 gen{12345};  // generador para las tenencias tabú
+    double timeLimit_ = 0.0;  // límite de tiempo en segundos (0 sin límite)
+    std::chrono::steady_clock::time_point start_; // inicio del último solve()
+    double timeToBest_ = 0.0; // segundos hasta la mejor solución
+    bool solving_ = false;    // solve() en curso
+    double elapsed_ = 0.0;    // segundos de búsqueda al terminar el último solve()
+    uint64_t instanceFingerprint_ = 0; // huella de la instancia, calculada al empezar solve()
+    Instrumentation::Report instrumentation_; // contadores del último solve()
+    MemoryAccounting::Report memoryUsage_; // uso del heap del último solve()
 
     // Estructuras de control
     int m;                   // número de instalaciones
@@ -40,10 +202,11 @@ private:
     std::vector<int> y_P2;   // solución de referencia para P2
     std::vector<int> y_P3;   // solución de referencia para P3
     std::vector<int> y_best; // mejor solución global
+    std::vector<int> y_initial; // solución inicial dada (arranque en caliente), vacía si no hay
     std::vector<int> t;      // tiempo del último cambio
     std::vector<int> h;      // contador de duración
     int k = 1, k0 = 1, c = 1, c0 = 0;
-    int z0, zk, z00;
+    int64_t z0, zk, z00;   // costos: actual del ciclo, último movimiento y mejor global
     int m1;
     int bestFacility = -1; ///< Mejor instalación encontrada
     int initialIndex;
@@ -56,6 +219,16 @@ private:
 
     // Tabú List y PLQT
     PLQT plqt_;
+    bool memoryRestored_ = false; ///< plqt_ viene de una instantánea y no se reinicia
+    ConcurrentVisitedSet *sharedMemory_ = nullptr; ///< Memoria compartida entre trabajadores
+    ConvergenceTrace *trace_ = nullptr; ///< Traza de convergencia, si se registra
+
+    // Puntos de control
+    std::unique_ptr<CheckpointWriter> checkpointWriter_; ///< Escritor en segundo plano, si hay puntos de control
+    std::string checkpointPath_;
+    double checkpointInterval_ = 0.0;
+    std::chrono::steady_clock::time_point lastCheckpoint_;
+    std::optional<SolverCheckpoint> resume_; ///< Estado a reanudar en el próximo solve()
 
     // Solución de referencia para path relinking
     std::vector<int> targetSolution;
@@ -64,13 +237,17 @@ private:
     std::vector<int> I3_; ///< Order of facilities used in initialization.
 
     std::vector<int> bar_I;
-    int bestDelta = std::numeric_limits<int>::max();
+    int64_t bestDelta = std::numeric_limits<int64_t>::max();
     double bestDelta_altering = std::numeric_limits<int>::max();
-    std::vector<int> deltaZ_values;
+    std::vector<int64_t> deltaZ_values;
+    std::vector<char> deltaExact_; ///< deltaZ_values[i] es exacto o solo una cota inferior
     std::vector<double> deltaZ_values_altering;
 
     // Funciones internas
     void initialize();
+    void restore();
+    void checkpointIfDue();
+    bool timeLimitReached() const;
     void mainSearchProcess();
     void intensification();
     void solutionReconciling();
@@ -78,9 +255,11 @@ private:
     void diversification();
     void executeMove(int i);
     bool isTabu(int i);
-    bool aspirationCriterion(int deltaZ);
-    int computeDeltaZ(int i);
-    int computeDeltaZ_altering(int i);
+    bool isVisited(const std::vector<int> &candidate) const;
+    bool aspirationCriterion(int64_t deltaZ);
+    int64_t computeDeltaZ(int i);
+    int64_t boundDeltaZ(int i, int64_t cutoff);
+    double computeDeltaZ_altering(int i);
     void computePriorities();
     bool isFeasibleToClose(int i);
     void evaluateNeighborhood();
@@ -2,8 +2,10 @@
 #define CFLP_TRANSPORT_SUBPROBLEM_H
 
 #include "TransportProblem/transport_problem.h"
+#include "TransportProblem/sparse_cost_matrix.h"
 #include <vector>
 #include <unordered_map>
+#include <cstdint>
 
 /**
  * @class CFLPTransportSubproblem
@@ -12,10 +14,16 @@
  * Efficiently builds and maintains a transportation problem based on which facilities are open.
  * Allows dynamic mutation by toggling the status of a single facility and maintains
  * global supply/demand tracking with efficient updates.
+ *
+ * @tparam Cost Type of the unit transportation costs (see CostTraits).
  */
-class CFLPTransportSubproblem
+template <typename Cost>
+class BasicCFLPTransportSubproblem
 {
 public:
+    using CostMatrix = std::vector<std::vector<Cost>>;
+    using Accumulator = typename CostTraits<Cost>::Accumulator;
+
     /**
      * @brief Constructor.
      * @param fullCostMatrix Complete CFLP cost matrix (facilities x clients).
@@ -23,15 +31,33 @@ public:
      * @param demands Vector of client demands.
      * @param openFacilities integer vector indicating which facilities are initially open.
      */
-    CFLPTransportSubproblem(const std::vector<std::vector<int>> &fullCostMatrix,
-                            const std::vector<int> &capacities,
-                            const std::vector<int> &demands,
-                            const std::vector<int> &openFacilities);
+    BasicCFLPTransportSubproblem(const CostMatrix &fullCostMatrix,
+                                 const std::vector<int> &capacities,
+                                 const std::vector<int> &demands,
+                                 const std::vector<int> &openFacilities);
+
+    /**
+     * @brief Constructor over a sparse cost matrix.
+     *
+     * Rows of open facilities are built from the k cheapest entries of each
+     * customer, with the lower bound of the matrix for the others. solve()
+     * loads the exact column of every customer whose assignment uses a bound
+     * and solves again, so the result is optimal for the exact costs. The
+     * matrix must outlive the subproblem.
+     * @param sparseCosts Sparse CFLP cost matrix (facilities x clients).
+     * @param capacities Vector of facility capacities.
+     * @param demands Vector of client demands.
+     * @param openFacilities integer vector indicating which facilities are initially open.
+     */
+    BasicCFLPTransportSubproblem(BasicSparseCostMatrix<Cost> &sparseCosts,
+                                 const std::vector<int> &capacities,
+                                 const std::vector<int> &demands,
+                                 const std::vector<int> &openFacilities);
 
-    CFLPTransportSubproblem();
+    BasicCFLPTransportSubproblem();
 
     /// @brief Destructor
-    ~CFLPTransportSubproblem() = default;
+    ~BasicCFLPTransportSubproblem() = default;
 
     /**
      * @brief Mutates the subproblem by toggling the open/closed status of a facility.
@@ -45,6 +71,26 @@ public:
      */
     void solve();
 
+    /**
+     * @brief Solves the subproblem unless its cost provably reaches a cutoff.
+     * When abandoned, the previous assignment and total cost are kept and
+     * getLowerBound() returns a bound of at least the cutoff.
+     * @param cutoff Transportation cost the caller needs to beat.
+     * @return true if solved to optimality; false if abandoned.
+     */
+    bool solve(Accumulator cutoff);
+
+    /**
+     * @brief Returns the lower bound on the transportation cost reached by the last solve.
+     */
+    Accumulator getLowerBound() const;
+
+    /**
+     * @brief Selects the construction of the initial flow of the Hungarian method.
+     * @param method Construction used by the following solves.
+     */
+    void setInitialFlow(InitialFlow method);
+
     /**
      * @brief Returns the current total supply (sum of open facilities' capacities).
      * @return Total supply value.
@@ -61,7 +107,7 @@ public:
      * @brief Access the underlying transportation problem.
      * @return Const reference to the TransportationProblem instance.
      */
-    const TransportationProblem &getTransportProblem() const;
+    const BasicTransportationProblem<Cost> &getTransportProblem() const;
 
     /**
      * @brief Returns the current open/closed status of facilities.
@@ -76,26 +122,48 @@ public:
     const std::vector<size_t> &getFacilityIndexMap() const;
 
     const std::vector<std::vector<int>> &getAssignmentMatrix() const;
-    int getTotalCost() const;
-    
+    Accumulator getTotalCost() const;
+
+    /**
+     * @brief Returns a compact hash of the last solved assignment.
+     * Two solves with the same assignment matrix yield the same fingerprint.
+     * @return FNV-1a hash over the non-zero entries of the assignment matrix.
+     */
+    uint64_t getAssignmentFingerprint() const;
+
     int getTotalSupply() const;
 
     int getTotalDemand() const;
 private:
-    std::vector<std::vector<int>> fullCostMatrix_; ///< Full CFLP cost matrix.
+    CostMatrix fullCostMatrix_;                    ///< Full CFLP cost matrix.
     std::vector<int> allCapacities_;               ///< Capacities of all facilities.
     std::vector<int> clientDemands_;               ///< Demands of all clients.
     std::vector<int> openFacilities_;             ///< Current open/closed status of facilities.
+    BasicSparseCostMatrix<Cost> *sparseCosts_ = nullptr; ///< Sparse costs, used instead of fullCostMatrix_ if set.
     std::vector<size_t> facilityIndexMap_;         ///< Maps subproblem indices to original indices
     std::vector<std::vector<int>> assignmentMatrix_; ///< Current assignment matrix.
-    int totalCost_;                                  ///< Total cost of current assignment.
+    Accumulator totalCost_ = 0;                      ///< Total cost of current assignment.
+    uint64_t assignmentFingerprint_ = 0;             ///< Hash of the current assignment matrix.
     std::vector<int> selectedSupplies_;
-    std::vector<std::vector<int>> selectedCosts_;
+    CostMatrix selectedCosts_;
+    CostMatrix spareCostRows_;                     ///< Rows of closed facilities, reused when one opens.
 
     int totalSupply_;                              ///< Current total supply (sum of open facilities)
     int totalDemand_;                              ///< Total demand (sum of all clients)
 
-    TransportationProblem transportProblem_; ///< Current subproblem (only open facilities).
+    BasicTransportationProblem<Cost> transportProblem_; ///< Current subproblem (only open facilities).
+    typename BasicTransportationProblem<Cost>::Workspace workspace_; ///< Hungarian tables reused by every solve.
+
+    void buildFromOpenFacilities();
+    void loadCostRow(size_t facility, std::vector<Cost> &row) const;
+    bool loadInexactColumns();
 };
 
+extern template class BasicCFLPTransportSubproblem<int32_t>;
+extern template class BasicCFLPTransportSubproblem<int64_t>;
+extern template class BasicCFLPTransportSubproblem<double>;
+
+/// Transport subproblem with integer costs.
+using CFLPTransportSubproblem = BasicCFLPTransportSubproblem<int>;
+
 #endif // CFLP_TRANSPORT_SUBPROBLEM_H
\ No newline at end of file
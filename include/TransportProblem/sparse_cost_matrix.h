@@ -0,0 +1,100 @@
+#ifndef SPARSE_COST_MATRIX_H
+#define SPARSE_COST_MATRIX_H
+
+#include "Utils/cost_traits.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class BasicSparseCostMatrix
+ * @brief Transportation costs restricted to the k cheapest facilities of each customer.
+ *
+ * Customers are appended one cost column at a time, so the dense matrix is
+ * never held in memory. Only the k cheapest entries of each column are kept
+ * (in compressed rows sorted by facility).
+ *
+ * Every dropped entry costs at least the most expensive kept entry of its
+ * column, so getCost() returns that value as a lower bound for them. When a
+ * column loader is set, loadColumn() fetches the exact column on demand (for
+ * example by re-reading the instance file) and later lookups for that
+ * customer are exact.
+ *
+ * @tparam Cost Type of the unit transportation costs (see CostTraits).
+ */
+template <typename Cost>
+class BasicSparseCostMatrix
+{
+public:
+    /// Returns the full cost column (one value per facility) of a customer.
+    using ColumnLoader = std::function<std::vector<Cost>(size_t customer)>;
+
+    /**
+     * @brief Creates an empty matrix.
+     * @param facilities Number of facilities (length of each column).
+     * @param neighbors Number of cheapest facilities kept per customer.
+     * @throws std::invalid_argument If either value is zero.
+     */
+    BasicSparseCostMatrix(size_t facilities, size_t neighbors);
+
+    /**
+     * @brief Appends the next customer, keeping its cheapest entries.
+     * @param column Cost from every facility to the customer.
+     * @throws std::invalid_argument If the column length differs from the facility count.
+     */
+    void appendCustomer(const std::vector<Cost> &column);
+
+    /** @brief Sets the loader used by loadColumn(). */
+    void setColumnLoader(ColumnLoader loader);
+
+    size_t getFacilityCount() const;
+    size_t getCustomerCount() const;
+    size_t getNeighborCount() const;
+
+    /** @brief Returns the number of kept entries over all customers. */
+    size_t getStoredEntryCount() const;
+
+    /**
+     * @brief Returns true if getCost(facility, customer) is the exact cost.
+     */
+    bool isExact(size_t facility, size_t customer) const;
+
+    /**
+     * @brief Returns the exact cost if known, otherwise a lower bound of it.
+     */
+    Cost getCost(size_t facility, size_t customer) const;
+
+    /**
+     * @brief Builds the cost row of a facility from getCost().
+     */
+    std::vector<Cost> getRow(size_t facility) const;
+
+    /**
+     * @brief Fetches the exact cost column of a customer through the loader.
+     * @return false if the column was already exact.
+     * @throws std::logic_error If no loader is set.
+     */
+    bool loadColumn(size_t customer);
+
+private:
+    size_t facilities_;
+    size_t neighbors_;
+    std::vector<size_t> offsets_;      ///< Start of each customer in the entry arrays.
+    std::vector<uint32_t> facilityIds_; ///< Kept facilities, sorted within each customer.
+    std::vector<Cost> costs_;           ///< Cost of each kept entry.
+    std::vector<Cost> bounds_;          ///< Most expensive kept cost of each customer.
+    std::unordered_map<size_t, std::vector<Cost>> loadedColumns_;
+    ColumnLoader loader_;
+    std::vector<uint32_t> order_;       ///< Scratch buffer for appendCustomer().
+};
+
+extern template class BasicSparseCostMatrix<int32_t>;
+extern template class BasicSparseCostMatrix<int64_t>;
+extern template class BasicSparseCostMatrix<double>;
+
+/// Sparse cost matrix with integer costs.
+using SparseCostMatrix = BasicSparseCostMatrix<int>;
+
+#endif // SPARSE_COST_MATRIX_H
@@ -1,7 +1,26 @@
 #ifndef TRANSPORTATION_PROBLEM_H
 #define TRANSPORTATION_PROBLEM_H
 
+#include "Utils/cost_traits.h"
 #include <vector>
+#include <cstddef>
+#include <utility>
+
+/**
+ * @brief Construction of the initial flow of the Hungarian method.
+ *
+ * After the row and column reductions the flow is built on the admissible
+ * cells (reduced cost zero) only, so the method keeps its optimality
+ * conditions whatever the construction; they differ in the order the cells
+ * are filled, and a larger initial flow leaves fewer augmentations.
+ */
+enum class InitialFlow
+{
+    Sequential, ///< Cells in index order.
+    Greedy,     ///< Cells in increasing order of unit cost.
+    Vogel,      ///< Vogel's approximation: the line with the largest regret between its two cheapest cells first.
+    Russell     ///< Russell's method: the cell with the most negative c_ij - u_i - v_j first.
+};
 
 /**
  * @class TransportationProblem
@@ -10,33 +29,87 @@
  * This class stores supply, demand, cost matrix, and the current assignment matrix.
  * It supports solving the problem using the Hungarian method and includes methods
  * for getting and setting data members.
+ *
+ * @tparam Cost Type of the unit transportation costs (see CostTraits).
+ * Quantities are always integers; the total cost is accumulated in 64 bits.
  */
-class TransportationProblem
+template <typename Cost>
+class BasicTransportationProblem
 {
 public:
+    using CostMatrix = std::vector<std::vector<Cost>>;
+    using Accumulator = typename CostTraits<Cost>::Accumulator;
+
     /**
      * @brief Constructor.
      * @param supply Vector of supply values.
      * @param demand Vector of demand values.
      * @param costMatrix 2D vector representing the cost matrix.
      */
-    TransportationProblem(const std::vector<int> &supply,
-                          const std::vector<int> &demand,
-                          const std::vector<std::vector<int>> &costMatrix);
+    BasicTransportationProblem(const std::vector<int> &supply,
+                               const std::vector<int> &demand,
+                               const CostMatrix &costMatrix);
 
     /// @brief Destructor.
-    ~TransportationProblem() = default;
+    ~BasicTransportationProblem() = default;
+
+    class Workspace;
 
     /**
      * @brief Solves the transportation problem using the Hungarian Method.
      */
     void solveHungarianMethod();
 
+    /**
+     * @brief Solves the transportation problem using the Hungarian Method,
+     * keeping its scratch tables in a caller-owned workspace.
+     * Once the workspace has grown to the problem size the solve allocates nothing.
+     * @param workspace Workspace reused across solves.
+     */
+    void solveHungarianMethod(Workspace &workspace);
+
+    /**
+     * @brief Solves the transportation problem unless its cost provably reaches a cutoff.
+     *
+     * The method keeps dual potentials u, v with nonnegative reduced costs,
+     * so sum(supply_i * u_i) + sum(demand_j * v_j) bounds the optimum from
+     * below and only grows. The solve is abandoned as soon as that bound
+     * reaches the cutoff; the assignment is then left empty.
+     * @param workspace Workspace reused across solves.
+     * @param cutoff Cost the caller needs to beat.
+     * @return true if solved to optimality; false if abandoned, with getLowerBound() >= cutoff.
+     */
+    bool solveHungarianMethod(Workspace &workspace, Accumulator cutoff);
+
+    /**
+     * @brief Returns the dual bound reached by the last solve.
+     * Once a solve finishes the bound is the optimum, i.e. getTotalCost() up to rounding.
+     */
+    Accumulator getLowerBound() const;
+
+    /**
+     * @brief Selects the construction of the initial flow (Sequential by default).
+     */
+    void setInitialFlow(InitialFlow method);
+
+    /** @brief Returns the construction of the initial flow. */
+    InitialFlow getInitialFlow() const;
+
+    /**
+     * @brief Replaces supply, demand and costs, reusing the storage of the previous ones.
+     * @param supply Vector of supply values.
+     * @param demand Vector of demand values.
+     * @param costMatrix 2D vector representing the cost matrix.
+     */
+    void reset(const std::vector<int> &supply,
+               const std::vector<int> &demand,
+               const CostMatrix &costMatrix);
+
     /**
      * @brief Returns the total cost of the current assignment.
-     * @return Total cost as an integer.
+     * @return Total cost, accumulated in 64 bits.
      */
-    int getTotalCost() const;
+    Accumulator getTotalCost() const;
 
     /**
      * @brief Returns the current assignment matrix.
@@ -48,13 +121,13 @@ public:
      * @brief Returns the cost matrix.
      * @return 2D vector of transportation costs.
      */
-    const std::vector<std::vector<int>> &getCostMatrix() const;
+    const CostMatrix &getCostMatrix() const;
 
     /**
      * @brief Sets the cost matrix.
      * @param newCostMatrix New cost matrix to be assigned.
      */
-    void setCostMatrix(const std::vector<std::vector<int>> &newCostMatrix);
+    void setCostMatrix(const CostMatrix &newCostMatrix);
 
     /**
      * @brief Returns the supply vector.
@@ -117,11 +190,15 @@ public:
 private:
     std::vector<int> supply_;                        ///< Vector of supply values.
     std::vector<int> demand_;                        ///< Vector of demand values.
-    std::vector<std::vector<int>> costMatrix_;       ///< Cost matrix.
+    CostMatrix costMatrix_;                          ///< Cost matrix.
     std::vector<std::vector<int>> assignmentMatrix_; ///< Current assignment matrix.
-    int totalCost_;                                  ///< Total cost of current assignment.
+    Accumulator totalCost_;                          ///< Total cost of current assignment.
+    Accumulator lowerBound_ = 0;                     ///< Dual objective of the last solve.
     int totalSupply_;                                ///< Total supply.
     int totalDemand_;                                ///< Total demand.
+    InitialFlow initialFlow_ = InitialFlow::Sequential; ///< Construction of the initial flow.
+    CostMatrix spareCostRows_;                       ///< Rows released by reset(), reused when it grows again.
+    std::vector<std::vector<int>> spareAssignmentRows_; ///< Same for the assignment matrix.
 
     /**
      * @brief Initializes or resets the assignment matrix.
@@ -136,46 +213,76 @@ private:
 
     struct MatrixEntry
     {
-        int init_cost;
-        int val;
+        Cost init_cost;
+        Cost val;
         int quota;
         bool starred;
         bool primed;
     };
 
-    using HungarianDataStructures = std::tuple<
-        std::vector<AgentJobEntry>,
-        std::vector<AgentJobEntry>,
-        std::vector<std::vector<MatrixEntry>>>;
+public:
+    /**
+     * @class Workspace
+     * @brief Scratch tables of the Hungarian method, reusable across solves.
+     *
+     * Each solve resets the tables in place. They only grow: rows and
+     * columns beyond the current problem are kept for later, larger ones,
+     * so a workspace reserved for the largest problem never allocates again.
+     * The list of admissible cells used by the Greedy, Vogel and Russell
+     * initial flows is not reserved; it is sized on first use to the
+     * cells actually admissible.
+     */
+    class Workspace
+    {
+    public:
+        /**
+         * @brief Grows the tables to hold a problem of the given size.
+         * @param agents Number of supply nodes.
+         * @param jobs Number of demand nodes, including the dummy one added by balance().
+         */
+        void reserve(size_t agents, size_t jobs);
+
+    private:
+        friend class BasicTransportationProblem;
 
+        void resize(size_t agents, size_t jobs);
+
+        std::vector<AgentJobEntry> agents_;
+        std::vector<AgentJobEntry> jobs_;
+        std::vector<std::vector<MatrixEntry>> matrix_; ///< Rows beyond agents_.size() are spare.
+        std::vector<MatrixEntry *> primedSeen_;        ///< Alternating path of executeStep2.
+        std::vector<MatrixEntry *> starredSeen_;
+        std::vector<std::pair<size_t, size_t>> cells_; ///< Admissible cells of the initial flow.
+        std::vector<Cost> lineFirst_;                  ///< Per row, then per column: cheapest (Vogel) or dearest (Russell) cost.
+        std::vector<Cost> lineSecond_;                 ///< Second cheapest cost of each line (Vogel).
+        std::vector<size_t> lineCell_;                 ///< Index in cells_ of the cheapest cell of each line (Vogel).
+    };
+
+private:
     void checkBalancedProblem() const;
-    HungarianDataStructures initializeDataStructures(size_t m, size_t n);
-    void preliminarReduction(std::vector<AgentJobEntry> &agents,
-                             std::vector<AgentJobEntry> &jobs,
-                             std::vector<std::vector<MatrixEntry>> &matrix);
-    bool isProblemSolved(const std::vector<AgentJobEntry> &agents,
-                         const std::vector<AgentJobEntry> &jobs) const;
-    void executeStep1(std::vector<AgentJobEntry> &agents,
-                      std::vector<AgentJobEntry> &jobs,
-                      std::vector<std::vector<MatrixEntry>> &matrix);
-    void executeStep2(size_t i0, size_t j0,
-                      std::vector<AgentJobEntry> &agents,
-                      std::vector<AgentJobEntry> &jobs,
-                      std::vector<std::vector<MatrixEntry>> &matrix);
-    void executeStep3(std::vector<AgentJobEntry> &agents,
-                      std::vector<AgentJobEntry> &jobs,
-                      std::vector<std::vector<MatrixEntry>> &matrix);
-    void markAgentAndStarJob(size_t i,
-                             std::vector<AgentJobEntry> &agents,
-                             std::vector<AgentJobEntry> &jobs,
-                             std::vector<std::vector<MatrixEntry>> &matrix);
-    void resetMarks(std::vector<AgentJobEntry> &agents,
-                    std::vector<AgentJobEntry> &jobs,
-                    std::vector<std::vector<MatrixEntry>> &matrix);
-    int findMinimumUnmarkedValue(const std::vector<AgentJobEntry> &agents,
-                                 const std::vector<AgentJobEntry> &jobs,
-                                 const std::vector<std::vector<MatrixEntry>> &matrix) const;
-    void finalizeSolution(const std::vector<std::vector<MatrixEntry>> &matrix);
+    void initializeDataStructures(Workspace &workspace);
+    void preliminarReduction(Workspace &workspace);
+    void assignQuota(size_t i, size_t j, Workspace &workspace);
+    void collectAdmissibleCells(Workspace &workspace);
+    void buildSequentialFlow(Workspace &workspace);
+    void buildGreedyFlow(Workspace &workspace);
+    void buildVogelFlow(Workspace &workspace);
+    void buildRussellFlow(Workspace &workspace);
+    bool isProblemSolved(const Workspace &workspace) const;
+    void executeStep1(Workspace &workspace);
+    void executeStep2(size_t i0, size_t j0, Workspace &workspace);
+    void executeStep3(Workspace &workspace);
+    void markAgentAndStarJob(size_t i, Workspace &workspace);
+    void resetMarks(Workspace &workspace);
+    Cost findMinimumUnmarkedValue(const Workspace &workspace) const;
+    void finalizeSolution(const Workspace &workspace);
 };
 
+extern template class BasicTransportationProblem<int32_t>;
+extern template class BasicTransportationProblem<int64_t>;
+extern template class BasicTransportationProblem<double>;
+
+/// Transportation problem with integer costs.
+using TransportationProblem = BasicTransportationProblem<int>;
+
 #endif // TRANSPORTATION_PROBLEM_H
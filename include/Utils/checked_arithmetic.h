@@ -0,0 +1,27 @@
+#ifndef CHECKED_ARITHMETIC_H
+#define CHECKED_ARITHMETIC_H
+
+#include <cstdint>
+
+/**
+ * @brief Size arithmetic that reports overflow instead of wrapping around.
+ *
+ * Used to validate the sizes read from file headers before they are
+ * compared with the file size or used to index the file contents.
+ */
+namespace CheckedArithmetic
+{
+    /** @brief Stores a * b in result; returns false if it does not fit in 64 bits. */
+    inline bool multiply(uint64_t a, uint64_t b, uint64_t &result)
+    {
+        return !__builtin_mul_overflow(a, b, &result);
+    }
+
+    /** @brief Stores a + b in result; returns false if it does not fit in 64 bits. */
+    inline bool add(uint64_t a, uint64_t b, uint64_t &result)
+    {
+        return !__builtin_add_overflow(a, b, &result);
+    }
+}
+
+#endif // CHECKED_ARITHMETIC_H
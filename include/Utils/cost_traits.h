@@ -0,0 +1,60 @@
+#ifndef COST_TRAITS_H
+#define COST_TRAITS_H
+
+#include <cmath>
+#include <cstdint>
+
+/**
+ * @brief Describes how a cost type stores instance costs and sums them.
+ *
+ * The solver classes are templated on the cost type and instantiated for:
+ * - int32_t: costs truncated to integers, the historical behaviour;
+ * - int64_t: fixed point with kScale units per cost unit, exact for the
+ *   five decimals of the OR-Library files;
+ * - double: costs kept as read.
+ *
+ * Totals are always accumulated in Accumulator, which is 64 bits wide.
+ */
+template <typename Cost>
+struct CostTraits;
+
+template <>
+struct CostTraits<int32_t>
+{
+    using Accumulator = int64_t;
+    static constexpr int64_t kScale = 1;
+
+    /** @brief Converts a decimal cost, truncating it. */
+    static int32_t fromDecimal(double value) { return static_cast<int32_t>(value); }
+
+    /** @brief Converts an accumulated cost back to cost units. */
+    static double toDouble(Accumulator value) { return static_cast<double>(value); }
+};
+
+template <>
+struct CostTraits<int64_t>
+{
+    using Accumulator = int64_t;
+    static constexpr int64_t kScale = 100000;
+
+    /** @brief Converts a decimal cost to fixed point, rounding to the nearest unit. */
+    static int64_t fromDecimal(double value) { return std::llround(value * kScale); }
+
+    /** @brief Converts an accumulated fixed-point cost back to cost units. */
+    static double toDouble(Accumulator value) { return static_cast<double>(value) / kScale; }
+};
+
+template <>
+struct CostTraits<double>
+{
+    using Accumulator = double;
+    static constexpr int64_t kScale = 1;
+
+    /** @brief Returns the cost unchanged. */
+    static double fromDecimal(double value) { return value; }
+
+    /** @brief Returns the accumulated cost unchanged. */
+    static double toDouble(Accumulator value) { return value; }
+};
+
+#endif // COST_TRAITS_H
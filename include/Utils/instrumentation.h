@@ -0,0 +1,201 @@
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+/**
+ * @brief Hot-path counters and timers, compiled in with -DCFLP_INSTRUMENTATION=ON.
+ *
+ * Every thread updates its own block of counters, so recording an event is a
+ * plain load and store on a thread-local value. Blocks are aggregated only
+ * when a report is requested. Without CFLP_INSTRUMENTATION the CFLP_* macros
+ * expand to nothing and every report is zero.
+ *
+ * Timers come in two kinds: TransportSolve measures the whole scope it
+ * wraps, while the tabu phases split the solve time exclusively, so a phase
+ * entered from another one stops the clock of the outer phase until it
+ * returns.
+ */
+namespace Instrumentation
+{
+#ifdef CFLP_INSTRUMENTATION
+    constexpr bool kEnabled = true;
+#else
+    constexpr bool kEnabled = false;
+#endif
+
+    enum class Counter
+    {
+        HungarianStep1,
+        HungarianStep2,
+        HungarianStep3,
+        TransportSolves,
+        TransportCutoffs, ///< Solves abandoned because their bound reached the cutoff.
+        Toggles,
+        PlqtProbes,
+        PlqtProbeDepth, ///< Nodes visited by all probes.
+        PlqtInserts,
+        PlqtInsertDepth, ///< Nodes visited by all inserts.
+        Count
+    };
+
+    enum class Timer
+    {
+        TransportSolve,
+        MainSearch,
+        Altering,
+        Reconciling,
+        PathRelinking,
+        Diversification,
+        Count
+    };
+
+    constexpr size_t kCounterCount = static_cast<size_t>(Counter::Count);
+    constexpr size_t kTimerCount = static_cast<size_t>(Timer::Count);
+
+    /** @brief Name used for a counter in the JSON report. */
+    const char *name(Counter counter);
+
+    /** @brief Name used for a timer in the JSON report. */
+    const char *name(Timer timer);
+
+    /**
+     * @brief Aggregated values of every counter and timer.
+     */
+    struct Report
+    {
+        std::array<uint64_t, kCounterCount> counters{};
+        std::array<uint64_t, kTimerCount> nanoseconds{};
+
+        uint64_t get(Counter counter) const { return counters[static_cast<size_t>(counter)]; }
+        double seconds(Timer timer) const { return nanoseconds[static_cast<size_t>(timer)] * 1e-9; }
+
+        Report &operator+=(const Report &other);
+        Report &operator-=(const Report &other);
+
+        /**
+         * @brief Writes the report as a JSON object.
+         * @param out Destination stream.
+         * @param indent Spaces before each nested line, to embed the object in another document.
+         */
+        void writeJson(std::ostream &out, int indent = 0) const;
+    };
+
+    /**
+     * @brief Values recorded so far by the calling thread.
+     * The difference of two calls measures the work done in between.
+     */
+    Report threadReport();
+
+    /**
+     * @brief Values recorded by every thread, including the ones that have finished.
+     */
+    Report collect();
+
+    /**
+     * @brief Zeroes the blocks of every live thread and the totals of finished ones.
+     * Threads recording at the same time may lose the events in flight.
+     */
+    void reset();
+
+    namespace detail
+    {
+        using Clock = std::chrono::steady_clock;
+
+        /// Bloque de contadores de un hilo; se registra al crearse y suma sus valores al terminar
+        struct ThreadBlock
+        {
+            std::array<std::atomic<uint64_t>, kCounterCount> counters{};
+            std::array<std::atomic<uint64_t>, kTimerCount> nanoseconds{};
+            int phase = -1;
+            Clock::time_point phaseStart;
+
+            ThreadBlock();
+            ~ThreadBlock();
+            ThreadBlock(const ThreadBlock &) = delete;
+            ThreadBlock &operator=(const ThreadBlock &) = delete;
+        };
+
+        inline ThreadBlock &local()
+        {
+            thread_local ThreadBlock block;
+            return block;
+        }
+
+        // Solo el hilo dueño escribe, así que no hace falta una operación atómica de lectura-escritura
+        inline void bump(std::atomic<uint64_t> &value, uint64_t amount)
+        {
+            value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        }
+
+        inline uint64_t elapsed(Clock::time_point from, Clock::time_point to)
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count());
+        }
+    }
+
+    /** @brief Adds amount to a counter of the calling thread. */
+    inline void add(Counter counter, uint64_t amount = 1)
+    {
+        detail::bump(detail::local().counters[static_cast<size_t>(counter)], amount);
+    }
+
+    /**
+     * @brief Adds the lifetime of the scope to a timer.
+     */
+    class ScopedTimer
+    {
+    public:
+        explicit ScopedTimer(Timer timer) : timer_(timer), start_(detail::Clock::now()) {}
+        ~ScopedTimer()
+        {
+            detail::bump(detail::local().nanoseconds[static_cast<size_t>(timer_)],
+                         detail::elapsed(start_, detail::Clock::now()));
+        }
+        ScopedTimer(const ScopedTimer &) = delete;
+        ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+    private:
+        Timer timer_;
+        detail::Clock::time_point start_;
+    };
+
+    /**
+     * @brief Charges the time spent in the scope to a phase, excluding nested phases.
+     */
+    class ScopedPhase
+    {
+    public:
+        explicit ScopedPhase(Timer phase);
+        ~ScopedPhase();
+        ScopedPhase(const ScopedPhase &) = delete;
+        ScopedPhase &operator=(const ScopedPhase &) = delete;
+
+    private:
+        int previous_;
+    };
+}
+
+#define CFLP_INSTRUMENTATION_CONCAT_(a, b) a##b
+#define CFLP_INSTRUMENTATION_CONCAT(a, b) CFLP_INSTRUMENTATION_CONCAT_(a, b)
+
+#ifdef CFLP_INSTRUMENTATION
+#define CFLP_COUNT(counter) ::Instrumentation::add(::Instrumentation::Counter::counter)
+#define CFLP_COUNT_N(counter, amount) ::Instrumentation::add(::Instrumentation::Counter::counter, (amount))
+#define CFLP_TIME_SCOPE(timer) \
+    ::Instrumentation::ScopedTimer CFLP_INSTRUMENTATION_CONCAT(cflpTimer_, __LINE__)(::Instrumentation::Timer::timer)
+#define CFLP_PHASE_SCOPE(phase) \
+    ::Instrumentation::ScopedPhase CFLP_INSTRUMENTATION_CONCAT(cflpPhase_, __LINE__)(::Instrumentation::Timer::phase)
+#else
+#define CFLP_COUNT(counter) ((void)0)
+#define CFLP_COUNT_N(counter, amount) ((void)0)
+#define CFLP_TIME_SCOPE(timer) ((void)0)
+#define CFLP_PHASE_SCOPE(phase) ((void)0)
+#endif
+
+#endif // INSTRUMENTATION_H
@@ -0,0 +1,50 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <cstddef>
+
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * The mapping lives as long as the object. Pointers returned by data()
+ * stay valid until the object is destroyed or moved from.
+ */
+class MappedFile
+{
+public:
+    /**
+     * @brief Maps the given file read-only.
+     * @param path Path of the file to map.
+     * @throws std::runtime_error If the file cannot be opened or mapped.
+     */
+    explicit MappedFile(const std::string &path);
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    /// @brief Unmaps the file.
+    ~MappedFile();
+
+    /** @brief Returns the first byte of the mapping (nullptr for an empty file). */
+    const char *data() const;
+
+    /** @brief Returns the size of the mapping in bytes. */
+    size_t size() const;
+
+    /** @brief Returns the path the mapping was created from. */
+    const std::string &path() const;
+
+private:
+    std::string path_;
+    const char *data_ = nullptr;
+    size_t size_ = 0;
+
+    void release();
+};
+
+#endif // MAPPED_FILE_H
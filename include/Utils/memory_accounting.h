@@ -0,0 +1,126 @@
+#ifndef MEMORY_ACCOUNTING_H
+#define MEMORY_ACCOUNTING_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+/**
+ * @brief Heap usage per subsystem, compiled in with -DCFLP_ALLOCATION_TRACKING=ON.
+ *
+ * The option replaces the global operator new and delete. Every block
+ * carries a small header with its size and the subsystem that requested
+ * it, which is the innermost CFLP_ALLOCATION_SCOPE active on the
+ * allocating thread (Other outside any scope). The library's containers
+ * therefore keep their std::allocator types while every allocation they
+ * make is counted.
+ *
+ * Counters are kept per thread, so the usage of a solve is read from the
+ * thread that runs it with a ThreadMeter. A block freed by another thread
+ * is subtracted from that thread's counters. Without the option nothing
+ * is replaced and every report is zero.
+ */
+namespace MemoryAccounting
+{
+#ifdef CFLP_ALLOCATION_TRACKING
+    constexpr bool kEnabled = true;
+#else
+    constexpr bool kEnabled = false;
+#endif
+
+    enum class Subsystem
+    {
+        Other,
+        Problem,
+        Transport,
+        Plqt,
+        Solver,
+        Count
+    };
+
+    constexpr size_t kSubsystemCount = static_cast<size_t>(Subsystem::Count);
+
+    /** @brief Name used for a subsystem in the JSON report. */
+    const char *name(Subsystem subsystem);
+
+    /**
+     * @brief Heap usage of one subsystem.
+     */
+    struct Usage
+    {
+        uint64_t allocations = 0; ///< Number of blocks allocated.
+        uint64_t totalBytes = 0;  ///< Bytes requested by all allocations.
+        int64_t currentBytes = 0; ///< Bytes still allocated.
+        int64_t peakBytes = 0;    ///< Highest value of currentBytes.
+    };
+
+    /**
+     * @brief Usage of every subsystem plus the peak of their sum.
+     */
+    struct Report
+    {
+        std::array<Usage, kSubsystemCount> usage{};
+        int64_t peakTotalBytes = 0; ///< Highest number of bytes allocated at once, all subsystems together.
+
+        const Usage &get(Subsystem subsystem) const { return usage[static_cast<size_t>(subsystem)]; }
+
+        /** @brief Sum of the subsystems; its peak is peakTotalBytes. */
+        Usage total() const;
+
+        /**
+         * @brief Writes the report as a JSON object.
+         * @param out Destination stream.
+         * @param indent Spaces before each nested line, to embed the object in another document.
+         */
+        void writeJson(std::ostream &out, int indent = 0) const;
+    };
+
+    /** @brief Usage of the calling thread since it started. */
+    Report threadUsage();
+
+    /**
+     * @brief Measures the heap usage of the calling thread from construction on.
+     *
+     * Peaks are reported as growth over the bytes allocated at construction,
+     * so they give the extra memory a solve needed.
+     */
+    class ThreadMeter
+    {
+    public:
+        ThreadMeter();
+
+        /** @brief Usage since construction. Call it from the constructing thread. */
+        Report read() const;
+
+    private:
+        Report start_;
+    };
+
+    /**
+     * @brief Charges the allocations of the calling thread to a subsystem while in scope.
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(Subsystem subsystem);
+        ~Scope();
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        Subsystem previous_;
+    };
+}
+
+#define CFLP_ALLOCATION_CONCAT_(a, b) a##b
+#define CFLP_ALLOCATION_CONCAT(a, b) CFLP_ALLOCATION_CONCAT_(a, b)
+
+#ifdef CFLP_ALLOCATION_TRACKING
+#define CFLP_ALLOCATION_SCOPE(subsystem) \
+    ::MemoryAccounting::Scope CFLP_ALLOCATION_CONCAT(cflpAllocation_, __LINE__)(::MemoryAccounting::Subsystem::subsystem)
+#else
+#define CFLP_ALLOCATION_SCOPE(subsystem) ((void)0)
+#endif
+
+#endif // MEMORY_ACCOUNTING_H
@@ -0,0 +1,82 @@
+#ifndef PARALLEL_FOR_H
+#define PARALLEL_FOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Calls body(index) for every index in [0, count) on several threads.
+ *
+ * Indices are handed out one at a time from a shared counter, so rows of
+ * uneven cost balance themselves. The first exception thrown by body stops
+ * the remaining work and is rethrown in the calling thread.
+ *
+ * @param count Number of indices.
+ * @param threads Number of threads; 0 uses std::thread::hardware_concurrency().
+ * @param body Callable taking a size_t index. It must be safe to call concurrently.
+ */
+template <typename Body>
+void parallelFor(size_t count, unsigned threads, Body body)
+{
+    if (threads == 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = static_cast<unsigned>(std::min<size_t>(threads, count));
+    if (threads <= 1)
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            body(index);
+        }
+        return;
+    }
+
+    std::atomic<size_t> next{0};
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    auto worker = [&]()
+    {
+        for (size_t index = next++; index < count; index = next++)
+        {
+            try
+            {
+                body(index);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
+                next = count;
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (unsigned t = 1; t < threads; ++t)
+    {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (std::thread &thread : pool)
+    {
+        thread.join();
+    }
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+#endif // PARALLEL_FOR_H
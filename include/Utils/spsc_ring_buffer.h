@@ -0,0 +1,124 @@
+#ifndef SPSC_RING_BUFFER_H
+#define SPSC_RING_BUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Fixed-capacity queue for one producer thread and one consumer thread.
+ *
+ * All slots are allocated by the constructor, so push() and pop() never
+ * allocate or lock: each side owns one index and reads the other side's
+ * index only when its cached copy says the buffer is full or empty. When
+ * the buffer is full push() fails instead of overwriting, so the consumer
+ * never sees a slot being rewritten.
+ *
+ * @tparam T Element type; it should be cheap to copy.
+ */
+template <typename T>
+class SpscRingBuffer
+{
+public:
+    /**
+     * @param capacity Minimum number of elements; rounded up to a power of two.
+     * @throws std::invalid_argument If capacity is 0.
+     */
+    explicit SpscRingBuffer(size_t capacity)
+    {
+        if (capacity == 0)
+        {
+            throw std::invalid_argument("Ring buffer capacity must be positive.");
+        }
+        size_t rounded = 1;
+        while (rounded < capacity)
+        {
+            rounded <<= 1;
+        }
+        slots_.resize(rounded);
+        mask_ = rounded - 1;
+    }
+
+    SpscRingBuffer(const SpscRingBuffer &) = delete;
+    SpscRingBuffer &operator=(const SpscRingBuffer &) = delete;
+
+    /**
+     * @brief Appends a value. Producer thread only.
+     * @return false if the buffer is full and the value was dropped.
+     */
+    bool push(const T &value)
+    {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head - cachedTail_ == slots_.size())
+        {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head - cachedTail_ == slots_.size())
+            {
+                return false;
+            }
+        }
+        slots_[head & mask_] = value;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest value. Consumer thread only.
+     * @return false if the buffer is empty.
+     */
+    bool pop(T &value)
+    {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == cachedHead_)
+        {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            if (tail == cachedHead_)
+            {
+                return false;
+            }
+        }
+        value = slots_[tail & mask_];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pops every value available and passes it to sink. Consumer thread only.
+     * @return Number of values popped.
+     */
+    template <typename Sink>
+    size_t drain(Sink sink)
+    {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        size_t head = head_.load(std::memory_order_acquire);
+        for (size_t index = tail; index != head; ++index)
+        {
+            sink(slots_[index & mask_]);
+        }
+        cachedHead_ = head;
+        tail_.store(head, std::memory_order_release);
+        return head - tail;
+    }
+
+    /** @brief Number of slots. */
+    size_t capacity() const { return slots_.size(); }
+
+    /** @brief Number of values waiting; exact only when neither side is running. */
+    size_t size() const
+    {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+private:
+    std::vector<T> slots_;
+    size_t mask_ = 0;
+
+    // Índices en líneas de caché distintas para que productor y consumidor no se estorben
+    alignas(64) std::atomic<size_t> head_{0};
+    size_t cachedTail_ = 0;
+    alignas(64) std::atomic<size_t> tail_{0};
+    size_t cachedHead_ = 0;
+};
+
+#endif // SPSC_RING_BUFFER_H
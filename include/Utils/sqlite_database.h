@@ -0,0 +1,69 @@
+#ifndef SQLITE_DATABASE_H
+#define SQLITE_DATABASE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+struct sqlite3;
+struct sqlite3_stmt;
+
+/**
+ * @class SqliteStatement
+ * @brief Prepared statement of a SqliteDatabase.
+ *
+ * Parameters and columns are 1-based and 0-based respectively, as in SQLite.
+ */
+class SqliteStatement
+{
+public:
+    void bind(int parameter, int64_t value);
+    void bind(int parameter, const std::string &value);
+
+    /**
+     * @brief Advances to the next row.
+     * @return true if a row is available, false when the statement is done.
+     * @throws std::runtime_error If the query fails.
+     */
+    bool step();
+
+    int64_t columnInt64(int column) const;
+    double columnDouble(int column) const;
+    std::string columnText(int column) const;
+
+private:
+    friend class SqliteDatabase;
+    SqliteStatement(sqlite3 *database, sqlite3_stmt *statement);
+
+    sqlite3 *database_;
+    std::unique_ptr<sqlite3_stmt, int (*)(sqlite3_stmt *)> statement_;
+};
+
+/**
+ * @class SqliteDatabase
+ * @brief Read-only connection to a SQLite database file.
+ */
+class SqliteDatabase
+{
+public:
+    /**
+     * @brief Opens the database read-only.
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    explicit SqliteDatabase(const std::string &path);
+
+    /**
+     * @brief Prepares a statement.
+     * @throws std::runtime_error If the SQL is invalid for this database.
+     */
+    SqliteStatement prepare(const std::string &sql) const;
+
+    /** @brief Returns the path the database was opened from. */
+    const std::string &path() const;
+
+private:
+    std::string path_;
+    std::unique_ptr<sqlite3, int (*)(sqlite3 *)> database_;
+};
+
+#endif // SQLITE_DATABASE_H
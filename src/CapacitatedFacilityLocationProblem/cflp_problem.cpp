@@ -1,12 +1,43 @@
 #include "CapacitatedFacilityLocationProblem/cflp_problem.h"
 #include "TransportProblem/cflp_tansport_problem.h"
+#include "Utils/instrumentation.h"
+#include "Utils/memory_accounting.h"
+#include <limits>
 #include <numeric>
 #include <iostream>
+#include <type_traits>
 
-CFLPProblem::CFLPProblem(std::vector<std::vector<int>> costMatrix,
-                         std::vector<int> capacities,
-                         std::vector<int> demands,
-                         std::vector<double> openingCosts)
+namespace
+{
+    /// Acumula bytes en un hash FNV-1a de 64 bits
+    class Fnv1a
+    {
+    public:
+        template <typename T>
+        void add(const T *values, size_t count)
+        {
+            const unsigned char *bytes = reinterpret_cast<const unsigned char *>(values);
+            for (size_t i = 0; i < count * sizeof(T); ++i)
+            {
+                hash_ = (hash_ ^ bytes[i]) * 1099511628211ULL;
+            }
+        }
+
+        template <typename T>
+        void add(T value) { add(&value, 1); }
+
+        uint64_t value() const { return hash_; }
+
+    private:
+        uint64_t hash_ = 14695981039346656037ULL;
+    };
+}
+
+template <typename Cost>
+BasicCFLPProblem<Cost>::BasicCFLPProblem(CostMatrix costMatrix,
+                                         std::vector<int> capacities,
+                                         std::vector<int> demands,
+                                         std::vector<double> openingCosts)
     : currentCost_(0),
       costMatrix_(std::move(costMatrix)),       // Movemos en lugar de copiar
       capacities_(std::move(capacities)),       // Movemos en lugar de copiar
@@ -17,10 +48,34 @@ CFLPProblem::CFLPProblem(std::vector<std::vector<int>> costMatrix,
     totalDemand_ = std::accumulate(demands_.begin(), demands_.end(), 0);
 }
 
-void CFLPProblem::initializeSubproblem(const std::vector<int> &solution)
+template <typename Cost>
+uint64_t BasicCFLPProblem<Cost>::getInstanceFingerprint() const
 {
-    subproblem_ = CFLPTransportSubproblem(costMatrix_, capacities_, demands_, solution);
+    Fnv1a hash;
+    hash.add(static_cast<uint64_t>(sizeof(Cost)));
+    hash.add(static_cast<uint64_t>(std::is_floating_point<Cost>::value));
+    hash.add(CostTraits<Cost>::kScale);
+    hash.add(static_cast<uint64_t>(costMatrix_.size()));
+    hash.add(static_cast<uint64_t>(demands_.size()));
+    for (const std::vector<Cost> &row : costMatrix_)
+    {
+        hash.add(row.data(), row.size());
+    }
+    hash.add(capacities_.data(), capacities_.size());
+    hash.add(demands_.data(), demands_.size());
+    hash.add(openingCosts_.data(), openingCosts_.size());
+    return hash.value();
+}
+
+template <typename Cost>
+void BasicCFLPProblem<Cost>::initializeSubproblem(const std::vector<int> &solution)
+{
+    CFLP_ALLOCATION_SCOPE(Problem);
+    bestSolution_ = solution;
+    subproblem_ = BasicCFLPTransportSubproblem<Cost>(costMatrix_, capacities_, demands_, solution);
+    subproblem_.setInitialFlow(initialFlow_);
     subproblem_.solve();
+    transportStale_ = false;
     costOfTransportation_ = subproblem_.getTotalCost();
     costOfFacilities_ = 0;
 
@@ -28,7 +83,7 @@ void CFLPProblem::initializeSubproblem(const std::vector<int> &solution)
     {
         if (solution[i] == 1)
         {
-            costOfFacilities_ += openingCosts_[i];
+            costOfFacilities_ += CostTraits<Cost>::fromDecimal(openingCosts_[i]);
         }
     }
 
@@ -45,107 +100,186 @@ void CFLPProblem::initializeSubproblem(const std::vector<int> &solution)
     currentCost_ = costOfFacilities_ + costOfTransportation_;
 }
 
-int CFLPProblem::getCurrentCost() const
+template <typename Cost>
+typename BasicCFLPProblem<Cost>::Accumulator BasicCFLPProblem<Cost>::getCurrentCost() const
 {
     return currentCost_;
 }
 
-void CFLPProblem::setCurrentCost(int cost)
+template <typename Cost>
+void BasicCFLPProblem<Cost>::setCurrentCost(Accumulator cost)
 {
     currentCost_ = cost;
 }
 
-const std::vector<int> &CFLPProblem::getBestSolution() const
+template <typename Cost>
+const std::vector<int> &BasicCFLPProblem<Cost>::getBestSolution() const
 {
     return bestSolution_;
 }
 
-void CFLPProblem::setBestSolution(const std::vector<int> &solution)
+template <typename Cost>
+void BasicCFLPProblem<Cost>::setBestSolution(const std::vector<int> &solution)
 {
     bestSolution_ = solution;
 }
 
-CFLPTransportSubproblem &CFLPProblem::getSubproblem()
+template <typename Cost>
+void BasicCFLPProblem<Cost>::setInitialFlow(InitialFlow method)
+{
+    initialFlow_ = method;
+    subproblem_.setInitialFlow(method);
+}
+
+template <typename Cost>
+BasicCFLPTransportSubproblem<Cost> &BasicCFLPProblem<Cost>::getSubproblem()
 {
+    if (transportStale_)
+    {
+        subproblem_.solve();
+        transportStale_ = false;
+    }
     return subproblem_;
 }
 
-const std::vector<std::vector<int>> &CFLPProblem::getCostMatrix() const
+template <typename Cost>
+const typename BasicCFLPProblem<Cost>::CostMatrix &BasicCFLPProblem<Cost>::getCostMatrix() const
 {
     return costMatrix_;
 }
 
-std::vector<std::vector<int>> &CFLPProblem::getCostMatrix()
+template <typename Cost>
+typename BasicCFLPProblem<Cost>::CostMatrix &BasicCFLPProblem<Cost>::getCostMatrix()
 {
     return costMatrix_;
 }
 
-const std::vector<int> &CFLPProblem::getCapacities() const
+template <typename Cost>
+const std::vector<int> &BasicCFLPProblem<Cost>::getCapacities() const
 {
     return capacities_;
 }
 
-std::vector<int> &CFLPProblem::getCapacities()
+template <typename Cost>
+std::vector<int> &BasicCFLPProblem<Cost>::getCapacities()
 {
     return capacities_;
 }
 
-const std::vector<int> &CFLPProblem::getDemands() const
+template <typename Cost>
+const std::vector<int> &BasicCFLPProblem<Cost>::getDemands() const
 {
     return demands_;
 }
 
-std::vector<int> &CFLPProblem::getDemands()
+template <typename Cost>
+std::vector<int> &BasicCFLPProblem<Cost>::getDemands()
 {
     return demands_;
 }
 
-const std::vector<double> &CFLPProblem::getOpeningCosts() const
+template <typename Cost>
+const std::vector<double> &BasicCFLPProblem<Cost>::getOpeningCosts() const
 {
     return openingCosts_;
 }
 
-std::vector<double> &CFLPProblem::getOpeningCosts()
+template <typename Cost>
+std::vector<double> &BasicCFLPProblem<Cost>::getOpeningCosts()
 {
     return openingCosts_;
 }
 
-int CFLPProblem::getCostOfFacilities() const
+template <typename Cost>
+typename BasicCFLPProblem<Cost>::Accumulator BasicCFLPProblem<Cost>::getCostOfFacilities() const
 {
     return costOfFacilities_;
 }
 
-int CFLPProblem::getCostOfTransportation() const
+template <typename Cost>
+typename BasicCFLPProblem<Cost>::Accumulator BasicCFLPProblem<Cost>::getCostOfTransportation() const
 {
     return costOfTransportation_;
 }
 
-int CFLPProblem::getTotalDemand() const
+template <typename Cost>
+int BasicCFLPProblem<Cost>::getTotalDemand() const
 {
     return totalDemand_;
 }
 
-int CFLPProblem::getCurrentTotalSupply() const
+template <typename Cost>
+int BasicCFLPProblem<Cost>::getCurrentTotalSupply() const
 {
     return currentTotalSupply_;
 }
 
-void CFLPProblem::toggleFacility(int facilityIndex)
+template <typename Cost>
+void BasicCFLPProblem<Cost>::toggleFacility(int facilityIndex)
 {
+    toggleFacility(facilityIndex, std::numeric_limits<Accumulator>::max());
+}
+
+template <typename Cost>
+bool BasicCFLPProblem<Cost>::toggleFacility(int facilityIndex, Accumulator cutoff)
+{
+    CFLP_COUNT(Toggles);
+    CFLP_ALLOCATION_SCOPE(Problem);
     if (bestSolution_[facilityIndex] == 1) {
         bestSolution_[facilityIndex] = 0;
         currentTotalSupply_ -= capacities_[facilityIndex];
-        costOfFacilities_ -= openingCosts_[facilityIndex];
+        costOfFacilities_ -= CostTraits<Cost>::fromDecimal(openingCosts_[facilityIndex]);
     } else { 
         bestSolution_[facilityIndex] = 1;
         currentTotalSupply_ += capacities_[facilityIndex];
-        costOfFacilities_ += openingCosts_[facilityIndex];
+        costOfFacilities_ += CostTraits<Cost>::fromDecimal(openingCosts_[facilityIndex]);
     }
 
     subproblem_.toggleFacility(facilityIndex);
-    subproblem_.solve();
+    currentTotalSupply_ = subproblem_.getCurrentTotalSupply();
+
+    if constexpr (std::is_integral_v<Accumulator>)
+    {
+        if (solutionCache_ != nullptr &&
+            solutionCache_->getDimension() == static_cast<int>(bestSolution_.size()))
+        {
+            std::optional<int64_t> cachedCost = solutionCache_->lookupCost(bestSolution_);
+            if (cachedCost.has_value())
+            {
+                currentCost_ = *cachedCost;
+                costOfTransportation_ = currentCost_ - costOfFacilities_;
+                transportStale_ = true;
+                return true;
+            }
+        }
+    }
+
+    if (!subproblem_.solve(cutoff - costOfFacilities_))
+    {
+        costOfTransportation_ = subproblem_.getLowerBound();
+        currentCost_ = costOfFacilities_ + costOfTransportation_;
+        transportStale_ = true;
+        return false;
+    }
+    transportStale_ = false;
 
     costOfTransportation_ = subproblem_.getTotalCost();
     currentCost_ = costOfFacilities_ + costOfTransportation_;
-    currentTotalSupply_ = subproblem_.getCurrentTotalSupply();
+    return true;
+}
+
+template <typename Cost>
+void BasicCFLPProblem<Cost>::setSolutionCache(const PLQT *cache)
+{
+    solutionCache_ = cache;
 }
+
+template <typename Cost>
+bool BasicCFLPProblem<Cost>::isTransportStale() const
+{
+    return transportStale_;
+}
+
+template class BasicCFLPProblem<int32_t>;
+template class BasicCFLPProblem<int64_t>;
+template class BasicCFLPProblem<double>;
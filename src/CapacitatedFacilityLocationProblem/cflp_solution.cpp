@@ -0,0 +1,183 @@
+#include "CapacitatedFacilityLocationProblem/cflp_solution.h"
+#include "Reader/text_scanner.h"
+#include "Utils/mapped_file.h"
+#include <charconv>
+#include <fstream>
+#include <stdexcept>
+
+CFLPSolution::CFLPSolution(std::vector<int> open, size_t customers, double cost,
+                           std::vector<SolutionAssignment> assignments)
+    : open_(std::move(open)), customers_(customers), cost_(cost), assignments_(std::move(assignments))
+{
+    for (int status : open_)
+    {
+        if (status != 0 && status != 1)
+        {
+            throw std::invalid_argument("Facility status must be 0 or 1.");
+        }
+    }
+    for (const SolutionAssignment &assignment : assignments_)
+    {
+        if (assignment.facility >= open_.size() || assignment.customer >= customers_)
+        {
+            throw std::invalid_argument("Assignment out of range.");
+        }
+    }
+}
+
+CFLPSolution CFLPSolution::evaluate(CFLPProblem &problem, const std::vector<int> &open, bool withAssignments)
+{
+    problem.initializeSubproblem(open);
+
+    std::vector<SolutionAssignment> assignments;
+    if (withAssignments)
+    {
+        const std::vector<std::vector<int>> &matrix = problem.getSubproblem().getAssignmentMatrix();
+        for (size_t i = 0; i < matrix.size(); ++i)
+        {
+            for (size_t j = 0; j < matrix[i].size(); ++j)
+            {
+                if (matrix[i][j] != 0)
+                {
+                    assignments.push_back({i, j, matrix[i][j]});
+                }
+            }
+        }
+    }
+
+    return CFLPSolution(open, problem.getDemands().size(), static_cast<double>(problem.getCurrentCost()),
+                        std::move(assignments));
+}
+
+CFLPSolution CFLPSolution::read(const std::string &path)
+{
+    MappedFile file(path);
+    TextScanner scanner(file.data(), file.data() + file.size(), path);
+
+    if (!scanner.consumeWord("CFLPSOL") || scanner.nextInteger("format version") != 1)
+    {
+        scanner.fail("not a version 1 CFLP solution file");
+    }
+    long long facilities = scanner.nextInteger("number of facilities");
+    long long customers = scanner.nextInteger("number of customers");
+    if (facilities <= 0 || customers <= 0)
+    {
+        scanner.fail("the numbers of facilities and customers must be positive");
+    }
+
+    if (!scanner.consumeWord("cost"))
+    {
+        scanner.fail("expected 'cost'");
+    }
+    double cost = scanner.nextDouble("solution cost");
+
+    if (!scanner.consumeWord("open"))
+    {
+        scanner.fail("expected 'open'");
+    }
+    std::vector<int> open(facilities, 0);
+    long long openCount = scanner.nextInteger("number of open facilities");
+    for (long long k = 0; k < openCount; ++k)
+    {
+        long long facility = scanner.nextInteger("open facility");
+        if (facility < 0 || facility >= facilities)
+        {
+            scanner.fail("open facility out of range");
+        }
+        open[facility] = 1;
+    }
+
+    std::vector<SolutionAssignment> assignments;
+    if (scanner.consumeWord("assignments"))
+    {
+        long long count = scanner.nextInteger("number of assignments");
+        assignments.reserve(count > 0 ? static_cast<size_t>(count) : 0);
+        for (long long k = 0; k < count; ++k)
+        {
+            long long facility = scanner.nextInteger("assigned facility");
+            long long customer = scanner.nextInteger("assigned customer");
+            long long amount = scanner.nextInteger("assigned amount");
+            if (facility < 0 || facility >= facilities || customer < 0 || customer >= customers)
+            {
+                scanner.fail("assignment out of range");
+            }
+            assignments.push_back({static_cast<size_t>(facility), static_cast<size_t>(customer),
+                                   static_cast<int>(amount)});
+        }
+    }
+
+    if (!scanner.atEnd())
+    {
+        scanner.fail("unexpected data after the solution");
+    }
+    return CFLPSolution(std::move(open), static_cast<size_t>(customers), cost, std::move(assignments));
+}
+
+void CFLPSolution::write(const std::string &path) const
+{
+    std::ofstream out(path, std::ios::trunc);
+    if (!out.is_open())
+    {
+        throw std::runtime_error("Unable to write solution: " + path);
+    }
+
+    // Representación más corta que se relee exactamente
+    char cost[32];
+    auto result = std::to_chars(cost, cost + sizeof(cost), cost_);
+
+    size_t openCount = 0;
+    for (int status : open_)
+    {
+        openCount += status;
+    }
+
+    out << "CFLPSOL 1\n" << open_.size() << " " << customers_ << "\n";
+    out << "cost " << std::string(cost, result.ptr) << "\n";
+    out << "open " << openCount << "\n";
+    for (size_t i = 0; i < open_.size(); ++i)
+    {
+        if (open_[i] == 1)
+        {
+            out << i << (--openCount == 0 ? "\n" : " ");
+        }
+    }
+    if (!assignments_.empty())
+    {
+        out << "assignments " << assignments_.size() << "\n";
+        for (const SolutionAssignment &assignment : assignments_)
+        {
+            out << assignment.facility << " " << assignment.customer << " " << assignment.amount << "\n";
+        }
+    }
+
+    out.close();
+    if (!out)
+    {
+        throw std::runtime_error("Error while writing solution: " + path);
+    }
+}
+
+const std::vector<int> &CFLPSolution::getOpenFacilities() const
+{
+    return open_;
+}
+
+size_t CFLPSolution::getFacilityCount() const
+{
+    return open_.size();
+}
+
+size_t CFLPSolution::getCustomerCount() const
+{
+    return customers_;
+}
+
+double CFLPSolution::getCost() const
+{
+    return cost_;
+}
+
+const std::vector<SolutionAssignment> &CFLPSolution::getAssignments() const
+{
+    return assignments_;
+}
@@ -0,0 +1,299 @@
+#include "Experiments/batch_runner.h"
+#include "Experiments/known_optima.h"
+#include "Reader/auto_instance_reader.h"
+#include "Reader/instance_batch_loader.h"
+#include "TabuSearch/tabu_search_solver.h"
+#include "Utils/parallel_for.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <filesystem>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+    std::string csvField(const std::string &text)
+    {
+        if (text.find_first_of(",\"\n") == std::string::npos)
+        {
+            return text;
+        }
+        std::string quoted = "\"";
+        for (char c : text)
+        {
+            quoted += c == '"' ? std::string("\"\"") : std::string(1, c);
+        }
+        return quoted + "\"";
+    }
+
+    std::string jsonString(const std::string &text)
+    {
+        std::ostringstream quoted;
+        quoted << '"';
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+                quoted << '\\' << c;
+            else if (static_cast<unsigned char>(c) < 0x20)
+                quoted << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+            else
+                quoted << c;
+        }
+        quoted << '"';
+        return quoted.str();
+    }
+
+    /**
+     * @brief Converts exact costs into the scaled integer unit costs the solver works with.
+     */
+    CFLPProblem toSolverCosts(const BasicCFLPProblem<double> &source, bool allocationCosts, double scale)
+    {
+        const std::vector<int> &demands = source.getDemands();
+        std::vector<std::vector<int>> costs(source.getCostMatrix().size(), std::vector<int>(demands.size()));
+        for (size_t i = 0; i < costs.size(); ++i)
+        {
+            for (size_t j = 0; j < demands.size(); ++j)
+            {
+                double unit = source.getCostMatrix()[i][j];
+                if (allocationCosts)
+                {
+                    unit = demands[j] > 0 ? unit / demands[j] : 0.0;
+                }
+                double scaled = std::round(unit * scale);
+                if (std::fabs(scaled) > INT_MAX)
+                {
+                    throw std::overflow_error("Scaled cost does not fit in an int; lower the cost scale.");
+                }
+                costs[i][j] = static_cast<int>(scaled);
+            }
+        }
+
+        std::vector<double> openingCosts = source.getOpeningCosts();
+        for (double &cost : openingCosts)
+        {
+            cost = std::round(cost * scale);
+        }
+        return CFLPProblem(std::move(costs), source.getCapacities(), demands, std::move(openingCosts));
+    }
+
+    /// Instancia cargada una sola vez, por el primer trabajador que la necesita
+    struct LoadedInstance
+    {
+        std::once_flag once;
+        std::shared_ptr<const CFLPProblem> problem;
+        std::string error;
+    };
+}
+
+BatchRunner::BatchRunner(BatchRunOptions options)
+    : options_(std::move(options))
+{
+    if (options_.instances.empty() || options_.seeds.empty() || options_.timeLimits.empty())
+    {
+        throw std::invalid_argument("A batch needs at least one instance, seed and time limit.");
+    }
+    if (!(options_.costScale > 0))
+    {
+        throw std::invalid_argument("The cost scale must be positive.");
+    }
+    for (double limit : options_.timeLimits)
+    {
+        if (limit < 0)
+        {
+            throw std::invalid_argument("Time limits must not be negative.");
+        }
+    }
+}
+
+std::vector<std::string> BatchRunner::instanceFiles() const
+{
+    std::vector<std::string> files;
+    for (const std::string &entry : options_.instances)
+    {
+        if (std::filesystem::is_regular_file(entry))
+        {
+            files.push_back(entry);
+            continue;
+        }
+        std::vector<std::string> matched = InstanceBatchLoader::listFiles(entry);
+        files.insert(files.end(), matched.begin(), matched.end());
+    }
+    std::sort(files.begin(), files.end());
+    files.erase(std::unique(files.begin(), files.end()), files.end());
+    return files;
+}
+
+CFLPProblem BatchRunner::loadInstance(const std::string &path, bool allocationCosts, double costScale)
+{
+    if (!(costScale > 0))
+    {
+        throw std::invalid_argument("The cost scale must be positive.");
+    }
+    return toSolverCosts(AutoInstanceReader().readInstanceAs<double>(path), allocationCosts, costScale);
+}
+
+std::vector<BatchRunResult> BatchRunner::run() const
+{
+    std::vector<std::string> files = instanceFiles();
+    InstanceBatchLoader loader(files, options_.threads, [this](const std::string &path)
+    {
+        return loadInstance(path, options_.allocationCosts, options_.costScale);
+    });
+    std::vector<LoadedInstance> loaded(files.size());
+
+    size_t perInstance = options_.seeds.size() * options_.timeLimits.size();
+    std::vector<BatchRunResult> results(files.size() * perInstance);
+    for (size_t r = 0; r < results.size(); ++r)
+    {
+        size_t variant = r % perInstance;
+        results[r].instance = files[r / perInstance];
+        results[r].seed = options_.seeds[variant / options_.timeLimits.size()];
+        results[r].timeLimit = options_.timeLimits[variant % options_.timeLimits.size()];
+        results[r].optimum = knownOptimum(results[r].instance);
+    }
+
+    if (!options_.traceDirectory.empty())
+    {
+        std::filesystem::create_directories(options_.traceDirectory);
+    }
+
+    parallelFor(results.size(), options_.threads, [&](size_t r)
+    {
+        BatchRunResult &result = results[r];
+        LoadedInstance &instance = loaded[r / perInstance];
+        std::call_once(instance.once, [&]()
+        {
+            try
+            {
+                instance.problem = std::make_shared<const CFLPProblem>(loader.get(r / perInstance));
+            }
+            catch (const std::exception &error)
+            {
+                instance.error = error.what();
+            }
+        });
+        if (!instance.problem)
+        {
+            result.error = instance.error;
+            return;
+        }
+
+        try
+        {
+            CFLPProblem problem = *instance.problem;
+            TabuSearchSolver solver(problem);
+            solver.setSeed(result.seed);
+            solver.setTimeLimit(result.timeLimit);
+
+            ConvergenceTrace trace;
+            std::unique_ptr<TraceDumper> dumper;
+            if (!options_.traceDirectory.empty())
+            {
+                std::ostringstream name;
+                name << std::filesystem::path(result.instance).stem().string() << "_seed" << result.seed
+                     << "_limit" << result.timeLimit << ".csv";
+                dumper = std::make_unique<TraceDumper>(
+                    trace, (std::filesystem::path(options_.traceDirectory) / name.str()).string());
+                solver.setTrace(&trace);
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            solver.solve();
+            result.totalTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            dumper.reset();
+
+            std::vector<int> best = solver.getBestSolution();
+            result.objective = solver.getBestCost() / options_.costScale;
+            result.timeToBest = solver.getTimeToBest();
+            result.iterations = solver.getIterationCount();
+            result.instrumentation = solver.getInstrumentation();
+            result.memory = solver.getMemoryUsage();
+            result.openFacilities = static_cast<int>(std::count(best.begin(), best.end(), 1));
+            if (result.optimum)
+            {
+                result.gap = 100.0 * (result.objective - *result.optimum) / *result.optimum;
+            }
+        }
+        catch (const std::exception &error)
+        {
+            result.error = error.what();
+        }
+    });
+    return results;
+}
+
+void BatchRunner::writeCsv(const std::vector<BatchRunResult> &results, std::ostream &out)
+{
+    out << "instance,seed,time_limit,objective,optimum,gap_percent,time_to_best,total_time,iterations,"
+           "open_facilities,error\n";
+    out << std::setprecision(12);
+    for (const BatchRunResult &result : results)
+    {
+        out << csvField(result.instance) << ',' << result.seed << ',' << result.timeLimit << ',';
+        if (result.error.empty())
+        {
+            out << result.objective;
+        }
+        out << ',';
+        if (result.optimum)
+        {
+            out << *result.optimum;
+        }
+        out << ',';
+        if (result.gap && result.error.empty())
+        {
+            out << *result.gap;
+        }
+        out << ',' << result.timeToBest << ',' << result.totalTime << ',' << result.iterations << ','
+            << result.openFacilities << ',' << csvField(result.error) << '\n';
+    }
+}
+
+void BatchRunner::writeJson(const std::vector<BatchRunResult> &results, std::ostream &out)
+{
+    out << std::setprecision(12) << "[\n";
+    for (size_t r = 0; r < results.size(); ++r)
+    {
+        const BatchRunResult &result = results[r];
+        out << "  {\"instance\": " << jsonString(result.instance) << ", \"seed\": " << result.seed
+            << ", \"time_limit\": " << result.timeLimit;
+        if (result.error.empty())
+        {
+            out << ", \"objective\": " << result.objective;
+        }
+        if (result.optimum)
+        {
+            out << ", \"optimum\": " << *result.optimum;
+        }
+        if (result.gap && result.error.empty())
+        {
+            out << ", \"gap_percent\": " << *result.gap;
+        }
+        out << ", \"time_to_best\": " << result.timeToBest << ", \"total_time\": " << result.totalTime
+            << ", \"iterations\": " << result.iterations << ", \"open_facilities\": " << result.openFacilities;
+        if (!result.error.empty())
+        {
+            out << ", \"error\": " << jsonString(result.error);
+        }
+        else
+        {
+            if (Instrumentation::kEnabled)
+            {
+                out << ", \"instrumentation\": ";
+                result.instrumentation.writeJson(out, 2);
+            }
+            if (MemoryAccounting::kEnabled)
+            {
+                out << ", \"memory\": ";
+                result.memory.writeJson(out, 2);
+            }
+        }
+        out << (r + 1 < results.size() ? "},\n" : "}\n");
+    }
+    out << "]\n";
+}
@@ -0,0 +1,27 @@
+#include "Experiments/known_optima.h"
+#include <filesystem>
+#include <unordered_map>
+
+std::optional<double> knownOptimum(const std::string &name)
+{
+    // Valores óptimos publicados en OR-Library (capopt)
+    static const std::unordered_map<std::string, double> optima = {
+        {"cap41", 1040444.375},   {"cap42", 1098000.450},   {"cap43", 1153000.450},   {"cap44", 1235500.450},
+        {"cap51", 1025208.225},   {"cap61", 932615.750},    {"cap62", 977799.400},    {"cap63", 1014062.050},
+        {"cap64", 1045650.250},   {"cap71", 932615.750},    {"cap72", 977799.400},    {"cap73", 1010641.450},
+        {"cap74", 1034976.975},   {"cap81", 838499.288},    {"cap82", 910889.563},    {"cap83", 975889.563},
+        {"cap84", 1069369.525},   {"cap91", 796648.438},    {"cap92", 855733.500},    {"cap93", 896617.538},
+        {"cap94", 946051.325},    {"cap101", 796648.437},   {"cap102", 854704.200},   {"cap103", 893782.112},
+        {"cap104", 928941.750},   {"cap111", 826124.713},   {"cap112", 901377.213},   {"cap113", 970567.750},
+        {"cap114", 1063356.488},  {"cap121", 793439.563},   {"cap122", 852524.625},   {"cap123", 895302.325},
+        {"cap124", 946051.325},   {"cap131", 793439.562},   {"cap132", 851495.325},   {"cap133", 893076.712},
+        {"cap134", 928941.750},   {"capa", 19240822.449},   {"capb", 13656379.578},   {"capc", 11646596.974},
+    };
+
+    auto found = optima.find(std::filesystem::path(name).stem().string());
+    if (found == optima.end())
+    {
+        return std::nullopt;
+    }
+    return found->second;
+}
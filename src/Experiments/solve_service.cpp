@@ -0,0 +1,565 @@
+#include "Experiments/solve_service.h"
+#include "Experiments/batch_runner.h"
+#include "TabuSearch/tabu_search_solver.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <list>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+    constexpr uint32_t kMaxFrameBytes = 16u << 20;
+
+    template <typename T>
+    T parseValue(const std::string &key, const std::string &value)
+    {
+        std::istringstream parser(value);
+        T parsed;
+        if (!(parser >> parsed) || !parser.eof())
+        {
+            throw std::invalid_argument("Invalid value for " + key + ": " + value);
+        }
+        return parsed;
+    }
+
+    std::string errorResponse(const std::string &id, std::string message)
+    {
+        std::replace(message.begin(), message.end(), '\n', ' ');
+        std::string response = id.empty() ? "" : "id=" + id + "\n";
+        return response + "status=error\nerror=" + message + "\n";
+    }
+
+    /// Lee exactamente size bytes; devuelve cuántos leyó antes del fin de la entrada
+    size_t readFully(int fd, char *data, size_t size)
+    {
+        size_t done = 0;
+        while (done < size)
+        {
+            ssize_t count = ::read(fd, data + done, size - done);
+            if (count == 0)
+            {
+                break;
+            }
+            if (count < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                throw std::runtime_error(std::string("Unable to read request: ") + std::strerror(errno));
+            }
+            done += static_cast<size_t>(count);
+        }
+        return done;
+    }
+    /// Borra el socket que dejó un servicio anterior; cualquier otro archivo se respeta
+    void removeStaleSocket(const std::string &path)
+    {
+        struct stat status;
+        if (::lstat(path.c_str(), &status) != 0)
+        {
+            if (errno == ENOENT)
+            {
+                return;
+            }
+            throw std::runtime_error("Unable to inspect " + path + ": " + std::strerror(errno));
+        }
+        if (!S_ISSOCK(status.st_mode))
+        {
+            throw std::runtime_error("Refusing to replace " + path + ": it exists and is not a socket");
+        }
+        ::unlink(path.c_str());
+    }
+}
+
+SolveRequest SolveRequest::parse(const std::string &payload)
+{
+    SolveRequest request;
+    std::istringstream lines(payload);
+    std::string line;
+    while (std::getline(lines, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+        if (line.empty())
+        {
+            continue;
+        }
+        size_t equals = line.find('=');
+        if (equals == std::string::npos)
+        {
+            throw std::invalid_argument("Expected key=value, found '" + line + "'");
+        }
+        std::string key = line.substr(0, equals);
+        std::string value = line.substr(equals + 1);
+
+        if (key == "id")
+            request.id = value;
+        else if (key == "command")
+            request.command = value;
+        else if (key == "instance")
+            request.instance = value;
+        else if (key == "seed")
+            request.seed = parseValue<unsigned>(key, value);
+        else if (key == "time_limit")
+            request.timeLimit = parseValue<double>(key, value);
+        else if (key == "unit_costs")
+            request.allocationCosts = !(value == "1" || value == "true");
+        else if (key == "cost_scale")
+            request.costScale = parseValue<double>(key, value);
+        else if (key == "initial")
+        {
+            request.initial.clear();
+            for (char status : value)
+            {
+                if (status != '0' && status != '1')
+                {
+                    throw std::invalid_argument("Invalid value for initial: " + value);
+                }
+                request.initial.push_back(status - '0');
+            }
+        }
+        else
+            throw std::invalid_argument("Unknown request key " + key);
+    }
+
+    if (request.command != "solve" && request.command != "stats" && request.command != "shutdown")
+    {
+        throw std::invalid_argument("Unknown command " + request.command);
+    }
+    if (request.timeLimit < 0)
+    {
+        throw std::invalid_argument("Time limit must not be negative.");
+    }
+    if (!(request.costScale > 0))
+    {
+        throw std::invalid_argument("The cost scale must be positive.");
+    }
+    return request;
+}
+
+SolveService::SolveService(unsigned workers)
+{
+    if (workers == 0)
+    {
+        workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (unsigned w = 0; w < workers; ++w)
+    {
+        workers_.emplace_back(&SolveService::work, this);
+    }
+}
+
+SolveService::~SolveService()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        stopping_ = true;
+    }
+    queueReady_.notify_all();
+    for (std::thread &worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+std::string SolveService::handle(const std::string &payload)
+{
+    SolveRequest request;
+    try
+    {
+        request = SolveRequest::parse(payload);
+    }
+    catch (const std::exception &error)
+    {
+        return errorResponse("", error.what());
+    }
+
+    std::string response = request.id.empty() ? "" : "id=" + request.id + "\n";
+    try
+    {
+        if (request.command == "stats")
+        {
+            return response + "status=ok\nresident_instances=" + std::to_string(residentInstances()) +
+                   "\nserved_requests=" + std::to_string(servedRequests()) + "\n";
+        }
+        if (request.command == "shutdown")
+        {
+            shutdown();
+            return response + "status=ok\n";
+        }
+        return response + solve(request);
+    }
+    catch (const std::exception &error)
+    {
+        return errorResponse(request.id, error.what());
+    }
+}
+
+std::shared_ptr<const CFLPProblem> SolveService::resident(const SolveRequest &request)
+{
+    std::ostringstream key;
+    key << request.instance << '\n' << request.allocationCosts << '\n' << std::setprecision(17) << request.costScale;
+
+    std::promise<std::shared_ptr<const CFLPProblem>> loading;
+    std::shared_future<std::shared_ptr<const CFLPProblem>> problem;
+    bool loader = false;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        auto found = cache_.find(key.str());
+        if (found != cache_.end())
+        {
+            problem = found->second;
+        }
+        else
+        {
+            problem = loading.get_future().share();
+            cache_.emplace(key.str(), problem);
+            loader = true;
+        }
+    }
+
+    // Solo el primer pedido de la instancia la carga; los demás esperan su resultado
+    if (loader)
+    {
+        try
+        {
+            loading.set_value(std::make_shared<const CFLPProblem>(
+                BatchRunner::loadInstance(request.instance, request.allocationCosts, request.costScale)));
+        }
+        catch (...)
+        {
+            {
+                std::lock_guard<std::mutex> lock(cacheMutex_);
+                cache_.erase(key.str());
+            }
+            loading.set_exception(std::current_exception());
+        }
+    }
+    return problem.get();
+}
+
+std::string SolveService::solve(const SolveRequest &request)
+{
+    if (request.instance.empty())
+    {
+        throw std::invalid_argument("A solve request needs an instance.");
+    }
+    CFLPProblem problem = *resident(request);
+    TabuSearchSolver solver(problem);
+    solver.setSeed(request.seed);
+    solver.setTimeLimit(request.timeLimit);
+    if (!request.initial.empty())
+    {
+        solver.setInitialSolution(request.initial);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    solver.solve();
+    double totalTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    served_.fetch_add(1, std::memory_order_relaxed);
+
+    std::ostringstream response;
+    response << std::setprecision(12) << "status=ok\nobjective=" << solver.getBestCost() / request.costScale
+             << "\nopen=";
+    for (int status : solver.getBestSolution())
+    {
+        response << status;
+    }
+    response << "\ntime_to_best=" << solver.getTimeToBest() << "\ntotal_time=" << totalTime
+             << "\niterations=" << solver.getIterationCount() << "\n";
+    return response.str();
+}
+
+void SolveService::submit(std::string payload, std::function<void(const std::string &)> reply)
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        queue_.push_back({std::move(payload), std::move(reply)});
+    }
+    queueReady_.notify_one();
+}
+
+void SolveService::work()
+{
+    while (true)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            queueReady_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            if (queue_.empty())
+            {
+                return;
+            }
+            job = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        std::string response = handle(job.payload);
+        try
+        {
+            job.reply(response);
+        }
+        catch (...)
+        {
+            // El cliente se fue; la respuesta se descarta
+        }
+    }
+}
+
+void SolveService::serveStream(int in, int out)
+{
+    std::mutex mutex;
+    std::condition_variable finished;
+    size_t pending = 0;
+    std::exception_ptr failure;
+    std::string shutdownRequest;
+
+    std::string payload;
+    try
+    {
+        while (!isShutDown() && readFrame(in, payload))
+        {
+            // El apagado se atiende aquí mismo, para no quedar bloqueados leyendo otra trama
+            try
+            {
+                if (SolveRequest::parse(payload).command == "shutdown")
+                {
+                    shutdownRequest = payload;
+                    break;
+                }
+            }
+            catch (const std::exception &)
+            {
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                ++pending;
+            }
+            submit(payload, [&, out](const std::string &response)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                try
+                {
+                    writeFrame(out, response);
+                }
+                catch (...)
+                {
+                }
+                --pending;
+                finished.notify_all();
+            });
+        }
+    }
+    catch (...)
+    {
+        failure = std::current_exception();
+    }
+
+    // Las respuestas en curso usan las variables locales, así que se esperan antes de salir
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [&] { return pending == 0; });
+    if (!shutdownRequest.empty())
+    {
+        writeFrame(out, handle(shutdownRequest));
+    }
+    if (failure)
+    {
+        std::rethrow_exception(failure);
+    }
+}
+
+void SolveService::serveSocket(const std::string &path)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path))
+    {
+        throw std::runtime_error("Socket path too long: " + path);
+    }
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    removeStaleSocket(path);
+
+    int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0)
+    {
+        throw std::runtime_error(std::string("Unable to create socket: ") + std::strerror(errno));
+    }
+    if (::bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0 || ::listen(listener, 16) < 0)
+    {
+        std::string reason = std::strerror(errno);
+        ::close(listener);
+        throw std::runtime_error("Unable to listen on " + path + ": " + reason);
+    }
+
+    std::mutex connectionsMutex;
+    std::set<int> open;
+    std::list<std::thread> connections;
+    std::vector<std::thread::id> finished;
+
+    // Une los hilos de las conexiones ya terminadas, para no acumularlos mientras el servicio corre
+    auto reap = [&]()
+    {
+        std::vector<std::thread::id> done;
+        {
+            std::lock_guard<std::mutex> lock(connectionsMutex);
+            done.swap(finished);
+        }
+        for (std::thread::id id : done)
+        {
+            auto it = std::find_if(connections.begin(), connections.end(),
+                                   [id](const std::thread &connection) { return connection.get_id() == id; });
+            it->join();
+            connections.erase(it);
+        }
+        connectionThreads_.store(connections.size());
+    };
+
+    while (!isShutDown())
+    {
+        reap();
+        pollfd ready{listener, POLLIN, 0};
+        if (::poll(&ready, 1, 100) <= 0)
+        {
+            continue;
+        }
+        int connection = ::accept(listener, nullptr, nullptr);
+        if (connection < 0)
+        {
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> lock(connectionsMutex);
+            open.insert(connection);
+        }
+        connections.emplace_back([this, connection, &connectionsMutex, &open, &finished]()
+        {
+            try
+            {
+                serveStream(connection, connection);
+            }
+            catch (...)
+            {
+                // Trama inválida o conexión rota: solo se cierra esta conexión
+            }
+            std::lock_guard<std::mutex> lock(connectionsMutex);
+            open.erase(connection);
+            ::close(connection);
+            finished.push_back(std::this_thread::get_id());
+        });
+        connectionThreads_.store(connections.size());
+    }
+
+    // Desbloquea las lecturas de las conexiones que siguen abiertas
+    {
+        std::lock_guard<std::mutex> lock(connectionsMutex);
+        for (int connection : open)
+        {
+            ::shutdown(connection, SHUT_RD);
+        }
+    }
+    for (std::thread &connection : connections)
+    {
+        connection.join();
+    }
+    connectionThreads_.store(0);
+    ::close(listener);
+    ::unlink(path.c_str());
+}
+
+void SolveService::shutdown()
+{
+    shutDown_.store(true);
+}
+
+bool SolveService::isShutDown() const
+{
+    return shutDown_.load();
+}
+
+size_t SolveService::connectionThreads() const
+{
+    return connectionThreads_.load();
+}
+
+size_t SolveService::residentInstances() const
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    return cache_.size();
+}
+
+size_t SolveService::servedRequests() const
+{
+    return served_.load(std::memory_order_relaxed);
+}
+
+bool SolveService::readFrame(int fd, std::string &payload)
+{
+    unsigned char header[4];
+    size_t got = readFully(fd, reinterpret_cast<char *>(header), sizeof(header));
+    if (got == 0)
+    {
+        return false;
+    }
+    if (got < sizeof(header))
+    {
+        throw std::runtime_error("Truncated request frame.");
+    }
+    uint32_t length = (uint32_t(header[0]) << 24) | (uint32_t(header[1]) << 16) | (uint32_t(header[2]) << 8) |
+                      uint32_t(header[3]);
+    if (length > kMaxFrameBytes)
+    {
+        throw std::runtime_error("Request frame too large.");
+    }
+    payload.assign(length, '\0');
+    if (readFully(fd, &payload[0], length) < length)
+    {
+        throw std::runtime_error("Truncated request frame.");
+    }
+    return true;
+}
+
+void SolveService::writeFrame(int fd, const std::string &payload)
+{
+    uint32_t length = static_cast<uint32_t>(payload.size());
+    std::string frame;
+    frame.reserve(payload.size() + 4);
+    frame.push_back(static_cast<char>(length >> 24));
+    frame.push_back(static_cast<char>(length >> 16));
+    frame.push_back(static_cast<char>(length >> 8));
+    frame.push_back(static_cast<char>(length));
+    frame += payload;
+
+    size_t done = 0;
+    while (done < frame.size())
+    {
+        // MSG_NOSIGNAL evita SIGPIPE si el cliente cerró el socket; con tuberías se usa write
+        ssize_t count = ::send(fd, frame.data() + done, frame.size() - done, MSG_NOSIGNAL);
+        if (count < 0 && errno == ENOTSOCK)
+        {
+            count = ::write(fd, frame.data() + done, frame.size() - done);
+        }
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw std::runtime_error(std::string("Unable to write response: ") + std::strerror(errno));
+        }
+        done += static_cast<size_t>(count);
+    }
+}
@@ -0,0 +1,67 @@
+#include "InstanceBuilder/geo_points.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    const double kDegreesToRadians = M_PI / 180.0;
+}
+
+void GeoPoints::add(double latitude, double longitude)
+{
+    double phi = latitude * kDegreesToRadians;
+    double lambda = longitude * kDegreesToRadians;
+    x_.push_back(std::cos(phi) * std::cos(lambda));
+    y_.push_back(std::cos(phi) * std::sin(lambda));
+    z_.push_back(std::sin(phi));
+}
+
+size_t GeoPoints::size() const
+{
+    return x_.size();
+}
+
+void GeoPoints::distancesFrom(size_t from, double *distancesKm) const
+{
+    distancesFromVector(x_[from], y_[from], z_[from], distancesKm);
+}
+
+void GeoPoints::distancesFrom(double latitude, double longitude, double *distancesKm) const
+{
+    double phi = latitude * kDegreesToRadians;
+    double lambda = longitude * kDegreesToRadians;
+    distancesFromVector(std::cos(phi) * std::cos(lambda), std::cos(phi) * std::sin(lambda), std::sin(phi),
+                        distancesKm);
+}
+
+void GeoPoints::distancesFromVector(double x, double y, double z, double *distancesKm) const
+{
+    const size_t count = x_.size();
+    const double *xs = x_.data();
+    const double *ys = y_.data();
+    const double *zs = z_.data();
+
+    // Mitad de la cuerda entre vectores unitarios, sin dependencias entre iteraciones
+    for (size_t j = 0; j < count; ++j)
+    {
+        double dx = xs[j] - x;
+        double dy = ys[j] - y;
+        double dz = zs[j] - z;
+        distancesKm[j] = 0.5 * std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+
+    for (size_t j = 0; j < count; ++j)
+    {
+        distancesKm[j] = 2.0 * kEarthRadiusKm * std::asin(std::min(1.0, distancesKm[j]));
+    }
+}
+
+double GeoPoints::haversineKm(double latitude1, double longitude1, double latitude2, double longitude2)
+{
+    double phi1 = latitude1 * kDegreesToRadians;
+    double phi2 = latitude2 * kDegreesToRadians;
+    double sinHalfPhi = std::sin((phi2 - phi1) / 2.0);
+    double sinHalfLambda = std::sin((longitude2 - longitude1) * kDegreesToRadians / 2.0);
+    double h = sinHalfPhi * sinHalfPhi + std::cos(phi1) * std::cos(phi2) * sinHalfLambda * sinHalfLambda;
+    return 2.0 * kEarthRadiusKm * std::asin(std::min(1.0, std::sqrt(h)));
+}
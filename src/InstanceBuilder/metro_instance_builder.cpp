@@ -0,0 +1,134 @@
+#include "InstanceBuilder/metro_instance_builder.h"
+#include "Utils/sqlite_database.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_map>
+
+MetroInstanceBuilder::MetroInstanceBuilder(std::string databasePath)
+    : databasePath_(std::move(databasePath))
+{
+}
+
+MetroNetwork MetroInstanceBuilder::loadNetwork() const
+{
+    SqliteDatabase database(databasePath_);
+    MetroNetwork network;
+
+    SqliteStatement stations = database.prepare(
+        "SELECT ID, NAME, ANNUAL_FLOW, LATITUDE, LONGITUDE FROM STATION ORDER BY ID");
+    std::unordered_map<int64_t, size_t> indexOf;
+    while (stations.step())
+    {
+        MetroStation station{stations.columnInt64(0), stations.columnText(1), stations.columnInt64(2),
+                             stations.columnDouble(3), stations.columnDouble(4)};
+        indexOf[station.id] = network.stations.size();
+        network.stations.push_back(std::move(station));
+    }
+
+    SqliteStatement connections =
+        database.prepare("SELECT STATION_ONE, STATION_TWO, DISTANCE FROM CONNECTION ORDER BY ID");
+    while (connections.step())
+    {
+        auto first = indexOf.find(connections.columnInt64(0));
+        auto second = indexOf.find(connections.columnInt64(1));
+        if (first == indexOf.end() || second == indexOf.end())
+        {
+            throw std::runtime_error("Connection refers to an unknown station in " + databasePath_);
+        }
+        network.connections.emplace_back(first->second, second->second);
+        network.lengths.push_back(connections.columnDouble(2));
+    }
+    return network;
+}
+
+StationGraph MetroInstanceBuilder::buildGraph(const MetroNetwork &network, MetroDistance distance)
+{
+    if (distance == MetroDistance::Hops)
+    {
+        return StationGraph(network.stations.size(), network.connections);
+    }
+
+    // Longitud de vía en metros: enteros en la base, así que los costos enteros no se truncan
+    if (network.lengths.size() != network.connections.size())
+    {
+        throw std::invalid_argument("Every connection needs a track length.");
+    }
+    return StationGraph(network.stations.size(), network.connections, network.lengths);
+}
+
+CFLPProblem MetroInstanceBuilder::build(const MetroOptions &options) const
+{
+    return buildAs<int>(options);
+}
+
+template <typename Cost>
+BasicCFLPProblem<Cost> MetroInstanceBuilder::buildAs(const MetroOptions &options) const
+{
+    return buildFromNetwork<Cost>(loadNetwork(), options);
+}
+
+template <typename Cost>
+BasicCFLPProblem<Cost> MetroInstanceBuilder::buildFromNetwork(const MetroNetwork &network,
+                                                              const MetroOptions &options)
+{
+    size_t n = network.stations.size();
+    size_t m = options.facilities == 0 ? n : std::min(options.facilities, n);
+    if (n == 0)
+    {
+        throw std::invalid_argument("The metro network has no stations.");
+    }
+    if (options.flowPerDemandUnit <= 0 || options.capacityFactor < 1.0)
+    {
+        throw std::invalid_argument("Demand units must be positive and capacity must cover demand.");
+    }
+
+    // Puntos de servicio candidatos: las estaciones con mayor afluencia, en orden de ID
+    std::vector<size_t> candidates(n);
+    std::iota(candidates.begin(), candidates.end(), 0);
+    std::stable_sort(candidates.begin(), candidates.end(), [&network](size_t a, size_t b)
+    {
+        return network.stations[a].annualFlow > network.stations[b].annualFlow;
+    });
+    candidates.resize(m);
+    std::sort(candidates.begin(), candidates.end());
+
+    std::vector<int> demands(n);
+    for (size_t j = 0; j < n; ++j)
+    {
+        demands[j] = static_cast<int>(std::ceil(network.stations[j].annualFlow / options.flowPerDemandUnit));
+    }
+    int64_t totalDemand = std::accumulate(demands.begin(), demands.end(), int64_t{0});
+    int capacity = static_cast<int>(std::ceil(options.capacityFactor * totalDemand / m));
+
+    StationGraph graph = buildGraph(network, options.distance);
+    std::vector<std::vector<double>> distances = graph.distancesFrom(candidates, options.threads);
+
+    std::vector<std::vector<Cost>> costs(m, std::vector<Cost>(n));
+    for (size_t i = 0; i < m; ++i)
+    {
+        for (size_t j = 0; j < n; ++j)
+        {
+            if (std::isinf(distances[i][j]))
+            {
+                throw std::invalid_argument("The metro network is disconnected: " + network.stations[j].name +
+                                            " cannot be reached from " + network.stations[candidates[i]].name);
+            }
+            costs[i][j] = CostTraits<Cost>::fromDecimal(distances[i][j] * options.costPerUnit);
+        }
+    }
+
+    return BasicCFLPProblem<Cost>(std::move(costs), std::vector<int>(m, capacity), std::move(demands),
+                                  std::vector<double>(m, options.openingCost));
+}
+
+template BasicCFLPProblem<int32_t> MetroInstanceBuilder::buildAs<int32_t>(const MetroOptions &) const;
+template BasicCFLPProblem<int64_t> MetroInstanceBuilder::buildAs<int64_t>(const MetroOptions &) const;
+template BasicCFLPProblem<double> MetroInstanceBuilder::buildAs<double>(const MetroOptions &) const;
+template BasicCFLPProblem<int32_t> MetroInstanceBuilder::buildFromNetwork<int32_t>(
+    const MetroNetwork &, const MetroOptions &);
+template BasicCFLPProblem<int64_t> MetroInstanceBuilder::buildFromNetwork<int64_t>(
+    const MetroNetwork &, const MetroOptions &);
+template BasicCFLPProblem<double> MetroInstanceBuilder::buildFromNetwork<double>(
+    const MetroNetwork &, const MetroOptions &);
@@ -0,0 +1,276 @@
+#include "InstanceBuilder/random_instance_generator.h"
+#include "Reader/binary_instance.h"
+#include "Utils/parallel_for.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+    const uint64_t kFacilityStream = 1;
+    const uint64_t kCustomerStream = 2;
+    const size_t kCostsPerLine = 10;
+
+    /**
+     * @brief Random numbers of one block.
+     *
+     * Draws are built from raw mt19937_64 output instead of the standard
+     * distributions, whose algorithms differ between libraries, so the same
+     * seed gives the same instance everywhere.
+     */
+    class BlockRandom
+    {
+    public:
+        BlockRandom(uint64_t seed, uint64_t stream, uint64_t block)
+        {
+            std::seed_seq sequence{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32),
+                                   static_cast<uint32_t>(stream), static_cast<uint32_t>(block),
+                                   static_cast<uint32_t>(block >> 32)};
+            engine_.seed(sequence);
+        }
+
+        double uniform(double low, double high)
+        {
+            return low + (high - low) * static_cast<double>(engine_() >> 11) * 0x1.0p-53;
+        }
+
+        int integer(int low, int high)
+        {
+            return low + static_cast<int>(engine_() % static_cast<uint64_t>(high - low + 1));
+        }
+
+    private:
+        std::mt19937_64 engine_;
+    };
+
+    double roundDecimals(double value)
+    {
+        return std::round(value * 1000.0) / 1000.0;
+    }
+
+    void appendNumber(std::string &text, double value)
+    {
+        char buffer[32];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, 3);
+        text.append(buffer, result.ptr);
+    }
+
+    /**
+     * @brief Renders blocks in parallel and hands them to sink in order.
+     *
+     * Blocks are processed in waves of a few per thread, so memory stays
+     * bounded by the wave while the output keeps its sequential order.
+     */
+    template <typename Buffer, typename Render, typename Sink>
+    void streamBlocks(size_t blocks, unsigned threads, Render render, Sink sink)
+    {
+        if (threads == 0)
+        {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        size_t wave = static_cast<size_t>(threads) * 4;
+        std::vector<Buffer> buffers(std::min(wave, blocks));
+        for (size_t first = 0; first < blocks; first += wave)
+        {
+            size_t count = std::min(wave, blocks - first);
+            parallelFor(count, threads, [&](size_t b) { render(first + b, buffers[b]); });
+            for (size_t b = 0; b < count; ++b)
+            {
+                sink(buffers[b]);
+            }
+        }
+    }
+
+    size_t blockCount(size_t items, size_t blockSize)
+    {
+        return (items + blockSize - 1) / blockSize;
+    }
+}
+
+RandomInstanceGenerator::RandomInstanceGenerator(const RandomInstanceOptions &options)
+    : threads_(options.threads)
+{
+    size_t m = options.facilities;
+    size_t n = options.customers;
+    if (m == 0 || n == 0)
+    {
+        throw std::invalid_argument("Random instances need at least one facility and one customer.");
+    }
+    if (!(options.capacityRatio >= 1.0))
+    {
+        throw std::invalid_argument("The capacity ratio must be at least 1.");
+    }
+
+    facilityX_.resize(m);
+    facilityY_.resize(m);
+    capacities_.resize(m);
+    openingCosts_.resize(m);
+    customerX_.resize(n);
+    customerY_.resize(n);
+    demands_.resize(n);
+
+    std::vector<double> rawCapacities(m);
+    std::vector<double> fixedPart(m);
+    std::vector<double> scalePart(m);
+    parallelFor(blockCount(m, kBlockSize), threads_, [&](size_t block)
+    {
+        BlockRandom random(options.seed, kFacilityStream, block);
+        for (size_t i = block * kBlockSize; i < std::min(m, (block + 1) * kBlockSize); ++i)
+        {
+            facilityX_[i] = random.uniform(0.0, 1.0);
+            facilityY_[i] = random.uniform(0.0, 1.0);
+            rawCapacities[i] = random.uniform(10.0, 160.0);
+            fixedPart[i] = random.uniform(0.0, 90.0);
+            scalePart[i] = random.uniform(100.0, 110.0);
+        }
+    });
+    parallelFor(blockCount(n, kBlockSize), threads_, [&](size_t block)
+    {
+        BlockRandom random(options.seed, kCustomerStream, block);
+        for (size_t j = block * kBlockSize; j < std::min(n, (block + 1) * kBlockSize); ++j)
+        {
+            customerX_[j] = random.uniform(0.0, 1.0);
+            customerY_[j] = random.uniform(0.0, 1.0);
+            demands_[j] = random.integer(5, 35);
+        }
+    });
+
+    // Escalar capacidades para que la oferta total sea capacityRatio veces la demanda total
+    double totalDemand = std::accumulate(demands_.begin(), demands_.end(), 0.0);
+    double totalRaw = std::accumulate(rawCapacities.begin(), rawCapacities.end(), 0.0);
+    double scale = options.capacityRatio * totalDemand / totalRaw;
+    for (size_t i = 0; i < m; ++i)
+    {
+        capacities_[i] = std::max(1, static_cast<int>(std::ceil(rawCapacities[i] * scale)));
+        openingCosts_[i] = roundDecimals(fixedPart[i] + scalePart[i] * std::sqrt(capacities_[i]));
+    }
+}
+
+const std::vector<int> &RandomInstanceGenerator::getCapacities() const
+{
+    return capacities_;
+}
+
+const std::vector<int> &RandomInstanceGenerator::getDemands() const
+{
+    return demands_;
+}
+
+const std::vector<double> &RandomInstanceGenerator::getOpeningCosts() const
+{
+    return openingCosts_;
+}
+
+double RandomInstanceGenerator::cost(size_t facility, size_t customer) const
+{
+    double dx = facilityX_[facility] - customerX_[customer];
+    double dy = facilityY_[facility] - customerY_[customer];
+    return roundDecimals(10.0 * demands_[customer] * std::sqrt(dx * dx + dy * dy));
+}
+
+CFLPProblem RandomInstanceGenerator::generate() const
+{
+    return generateAs<int>();
+}
+
+template <typename Cost>
+BasicCFLPProblem<Cost> RandomInstanceGenerator::generateAs() const
+{
+    size_t m = capacities_.size();
+    size_t n = demands_.size();
+    std::vector<std::vector<Cost>> costs(m, std::vector<Cost>(n));
+    parallelFor(m, threads_, [&](size_t i)
+    {
+        for (size_t j = 0; j < n; ++j)
+        {
+            costs[i][j] = CostTraits<Cost>::fromDecimal(cost(i, j));
+        }
+    });
+    return BasicCFLPProblem<Cost>(std::move(costs), capacities_, demands_, openingCosts_);
+}
+
+void RandomInstanceGenerator::writeText(const std::string &path) const
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+    {
+        throw std::runtime_error("Unable to write instance: " + path);
+    }
+
+    size_t m = capacities_.size();
+    size_t n = demands_.size();
+    std::string header = " " + std::to_string(m) + " " + std::to_string(n) + "\n";
+    for (size_t i = 0; i < m; ++i)
+    {
+        header += " " + std::to_string(capacities_[i]) + " ";
+        appendNumber(header, openingCosts_[i]);
+        header += "\n";
+    }
+    out << header;
+
+    // Bloques de clientes: demanda seguida de los m costos, diez por renglón
+    size_t blockSize = std::max<size_t>(1, kBlockSize / std::max<size_t>(1, m / 64));
+    streamBlocks<std::string>(
+        blockCount(n, blockSize), threads_,
+        [&](size_t block, std::string &text)
+        {
+            text.clear();
+            for (size_t j = block * blockSize; j < std::min(n, (block + 1) * blockSize); ++j)
+            {
+                text += " " + std::to_string(demands_[j]) + "\n";
+                for (size_t i = 0; i < m; ++i)
+                {
+                    text += ' ';
+                    appendNumber(text, cost(i, j));
+                    if ((i + 1) % kCostsPerLine == 0 || i + 1 == m)
+                    {
+                        text += '\n';
+                    }
+                }
+            }
+        },
+        [&](const std::string &text) { out.write(text.data(), static_cast<std::streamsize>(text.size())); });
+
+    out.close();
+    if (!out)
+    {
+        throw std::runtime_error("Error while writing instance: " + path);
+    }
+}
+
+void RandomInstanceGenerator::writeBinary(const std::string &path) const
+{
+    size_t m = capacities_.size();
+    size_t n = demands_.size();
+    BinaryInstance::Writer writer(path, capacities_, demands_, openingCosts_);
+
+    // Bloques de renglones de facilidades de alrededor de un megabyte
+    size_t rowsPerBlock = std::max<size_t>(1, (1u << 17) / n);
+    streamBlocks<std::vector<double>>(
+        blockCount(m, rowsPerBlock), threads_,
+        [&](size_t block, std::vector<double> &rows)
+        {
+            size_t first = block * rowsPerBlock;
+            size_t count = std::min(m, first + rowsPerBlock) - first;
+            rows.resize(count * n);
+            for (size_t r = 0; r < count; ++r)
+            {
+                for (size_t j = 0; j < n; ++j)
+                {
+                    rows[r * n + j] = cost(first + r, j);
+                }
+            }
+        },
+        [&](const std::vector<double> &rows) { writer.appendCostRows(rows.data(), rows.size() / n); });
+
+    writer.finish();
+}
+
+template BasicCFLPProblem<int32_t> RandomInstanceGenerator::generateAs<int32_t>() const;
+template BasicCFLPProblem<int64_t> RandomInstanceGenerator::generateAs<int64_t>() const;
+template BasicCFLPProblem<double> RandomInstanceGenerator::generateAs<double>() const;
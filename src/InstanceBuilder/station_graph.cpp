@@ -0,0 +1,139 @@
+#include "InstanceBuilder/station_graph.h"
+#include "Utils/parallel_for.h"
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+
+StationGraph::StationGraph(size_t nodes, const std::vector<Edge> &edges, const std::vector<double> &weights)
+    : offsets_(nodes + 1, 0)
+{
+    if (!weights.empty() && weights.size() != edges.size())
+        throw std::invalid_argument("There must be one weight per edge.");
+
+    for (const Edge &edge : edges)
+    {
+        if (edge.first >= nodes || edge.second >= nodes)
+            throw std::invalid_argument("Edge endpoint out of range.");
+        ++offsets_[edge.first + 1];
+        ++offsets_[edge.second + 1];
+    }
+    std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
+
+    targets_.resize(offsets_.back());
+    if (!weights.empty())
+    {
+        lengths_.resize(offsets_.back());
+    }
+
+    std::vector<size_t> next(offsets_.begin(), offsets_.end() - 1);
+    for (size_t e = 0; e < edges.size(); ++e)
+    {
+        double length = weights.empty() ? 1.0 : weights[e];
+        if (length < 0)
+            throw std::invalid_argument("Edge weights must not be negative.");
+
+        for (auto [from, to] : {edges[e], Edge{edges[e].second, edges[e].first}})
+        {
+            size_t slot = next[from]++;
+            targets_[slot] = static_cast<uint32_t>(to);
+            if (!weights.empty())
+            {
+                lengths_[slot] = length;
+            }
+        }
+    }
+}
+
+size_t StationGraph::getNodeCount() const
+{
+    return offsets_.size() - 1;
+}
+
+size_t StationGraph::getEdgeCount() const
+{
+    return targets_.size() / 2;
+}
+
+void StationGraph::distancesFrom(size_t source, std::vector<double> &distances) const
+{
+    if (source >= getNodeCount())
+        throw std::out_of_range("Invalid source node");
+
+    distances.assign(getNodeCount(), std::numeric_limits<double>::infinity());
+    if (lengths_.empty())
+    {
+        breadthFirst(source, distances);
+    }
+    else
+    {
+        dijkstra(source, distances);
+    }
+}
+
+std::vector<std::vector<double>> StationGraph::distancesFrom(const std::vector<size_t> &sources,
+                                                             unsigned threads) const
+{
+    std::vector<std::vector<double>> rows(sources.size());
+    parallelFor(sources.size(), threads, [&](size_t r)
+    {
+        distancesFrom(sources[r], rows[r]);
+    });
+    return rows;
+}
+
+std::vector<std::vector<double>> StationGraph::allPairs(unsigned threads) const
+{
+    std::vector<size_t> sources(getNodeCount());
+    std::iota(sources.begin(), sources.end(), 0);
+    return distancesFrom(sources, threads);
+}
+
+void StationGraph::breadthFirst(size_t source, std::vector<double> &distances) const
+{
+    std::vector<uint32_t> frontier = {static_cast<uint32_t>(source)};
+    distances[source] = 0.0;
+    for (size_t head = 0; head < frontier.size(); ++head)
+    {
+        uint32_t node = frontier[head];
+        for (size_t slot = offsets_[node]; slot < offsets_[node + 1]; ++slot)
+        {
+            uint32_t neighbour = targets_[slot];
+            if (distances[neighbour] == std::numeric_limits<double>::infinity())
+            {
+                distances[neighbour] = distances[node] + 1.0;
+                frontier.push_back(neighbour);
+            }
+        }
+    }
+}
+
+void StationGraph::dijkstra(size_t source, std::vector<double> &distances) const
+{
+    using Entry = std::pair<double, uint32_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+
+    distances[source] = 0.0;
+    heap.emplace(0.0, static_cast<uint32_t>(source));
+    while (!heap.empty())
+    {
+        auto [distance, node] = heap.top();
+        heap.pop();
+        if (distance > distances[node])
+        {
+            continue; // entrada obsoleta
+        }
+
+        for (size_t slot = offsets_[node]; slot < offsets_[node + 1]; ++slot)
+        {
+            double candidate = distance + lengths_[slot];
+            uint32_t neighbour = targets_[slot];
+            if (candidate < distances[neighbour])
+            {
+                distances[neighbour] = candidate;
+                heap.emplace(candidate, neighbour);
+            }
+        }
+    }
+}
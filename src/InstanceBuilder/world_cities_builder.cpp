@@ -0,0 +1,119 @@
+#include "InstanceBuilder/world_cities_builder.h"
+#include "InstanceBuilder/geo_points.h"
+#include "Utils/parallel_for.h"
+#include "Utils/sqlite_database.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+WorldCitiesInstanceBuilder::WorldCitiesInstanceBuilder(std::string databasePath)
+    : databasePath_(std::move(databasePath))
+{
+}
+
+std::vector<City> WorldCitiesInstanceBuilder::loadCities(const WorldCitiesOptions &options) const
+{
+    SqliteDatabase database(databasePath_);
+
+    std::string sql = "SELECT city_ascii, country, lat, lng, population FROM worldcities "
+                      "WHERE population IS NOT NULL AND population >= ?";
+    if (!options.countries.empty())
+    {
+        sql += " AND country IN (?";
+        for (size_t c = 1; c < options.countries.size(); ++c)
+        {
+            sql += ", ?";
+        }
+        sql += ")";
+    }
+    sql += " ORDER BY population DESC, id";
+    if (options.customers > 0)
+    {
+        sql += " LIMIT ?";
+    }
+
+    SqliteStatement statement = database.prepare(sql);
+    int parameter = 1;
+    statement.bind(parameter++, options.minPopulation);
+    for (const std::string &country : options.countries)
+    {
+        statement.bind(parameter++, country);
+    }
+    if (options.customers > 0)
+    {
+        statement.bind(parameter++, static_cast<int64_t>(options.customers));
+    }
+
+    std::vector<City> cities;
+    while (statement.step())
+    {
+        cities.push_back({statement.columnText(0), statement.columnText(1), statement.columnDouble(2),
+                          statement.columnDouble(3), statement.columnInt64(4)});
+    }
+    return cities;
+}
+
+CFLPProblem WorldCitiesInstanceBuilder::build(const WorldCitiesOptions &options) const
+{
+    return buildAs<int>(options);
+}
+
+template <typename Cost>
+BasicCFLPProblem<Cost> WorldCitiesInstanceBuilder::buildAs(const WorldCitiesOptions &options) const
+{
+    return buildFromCities<Cost>(loadCities(options), options);
+}
+
+template <typename Cost>
+BasicCFLPProblem<Cost> WorldCitiesInstanceBuilder::buildFromCities(const std::vector<City> &cities,
+                                                                   const WorldCitiesOptions &options)
+{
+    size_t n = cities.size();
+    size_t m = std::min(options.facilities, n);
+    if (n == 0 || m == 0)
+    {
+        throw std::invalid_argument("The options select no customer or no facility.");
+    }
+    if (options.populationPerDemandUnit <= 0 || options.capacityFactor < 1.0)
+    {
+        throw std::invalid_argument("Demand units must be positive and capacity must cover demand.");
+    }
+
+    GeoPoints customers;
+    std::vector<int> demands(n);
+    for (size_t j = 0; j < n; ++j)
+    {
+        customers.add(cities[j].latitude, cities[j].longitude);
+        demands[j] = static_cast<int>(std::ceil(cities[j].population / options.populationPerDemandUnit));
+    }
+
+    int64_t totalDemand = std::accumulate(demands.begin(), demands.end(), int64_t{0});
+    int capacity = static_cast<int>(std::ceil(options.capacityFactor * totalDemand / m));
+    std::vector<int> capacities(m, capacity);
+    std::vector<double> openingCosts(m, options.openingCost);
+
+    std::vector<std::vector<Cost>> costs(m, std::vector<Cost>(n));
+    parallelFor(m, options.threads, [&](size_t i)
+    {
+        std::vector<double> distances(n);
+        customers.distancesFrom(i, distances.data());
+        for (size_t j = 0; j < n; ++j)
+        {
+            costs[i][j] = CostTraits<Cost>::fromDecimal(distances[j] * options.costPerKm);
+        }
+    });
+
+    return BasicCFLPProblem<Cost>(std::move(costs), std::move(capacities), std::move(demands),
+                                  std::move(openingCosts));
+}
+
+template BasicCFLPProblem<int32_t> WorldCitiesInstanceBuilder::buildAs<int32_t>(const WorldCitiesOptions &) const;
+template BasicCFLPProblem<int64_t> WorldCitiesInstanceBuilder::buildAs<int64_t>(const WorldCitiesOptions &) const;
+template BasicCFLPProblem<double> WorldCitiesInstanceBuilder::buildAs<double>(const WorldCitiesOptions &) const;
+template BasicCFLPProblem<int32_t> WorldCitiesInstanceBuilder::buildFromCities<int32_t>(
+    const std::vector<City> &, const WorldCitiesOptions &);
+template BasicCFLPProblem<int64_t> WorldCitiesInstanceBuilder::buildFromCities<int64_t>(
+    const std::vector<City> &, const WorldCitiesOptions &);
+template BasicCFLPProblem<double> WorldCitiesInstanceBuilder::buildFromCities<double>(
+    const std::vector<City> &, const WorldCitiesOptions &);
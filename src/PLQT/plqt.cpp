@@ -1,8 +1,11 @@
 #include "PLQT/plqt.h"
 #include "PLQT/plqt_node.h"
+#include "Utils/instrumentation.h"
+#include "Utils/memory_accounting.h"
 #include <sstream>
 #include <cmath>
 #include <iostream>
+#include <algorithm>
 
 PLQT::PLQT(int dim, PLQTNode *root) : dimension(dim), root(root), powerOfTwo(0)
 {
@@ -10,7 +13,8 @@ PLQT::PLQT(int dim, PLQTNode *root) : dimension(dim), root(root), powerOfTwo(0)
     {
         throw std::invalid_argument("Dimension must be greater than 0.");
     }
-    powerOfTwo = PowerOfTwo(dim);
+    powerOfTwo = PowerOfTwo(std::min(dim, 64));
+    successorKey_.assign((dim + 63) / 64, 0);
 }
 
 PLQT::PLQT() : dimension(0), root(nullptr), powerOfTwo(0)
@@ -18,9 +22,58 @@ PLQT::PLQT() : dimension(0), root(nullptr), powerOfTwo(0)
     // Default constructor
 }
 
+PLQT::PLQT(PLQT &&other) noexcept
+    : root(other.root), dimension(other.dimension), powerOfTwo(other.powerOfTwo),
+      successorKey_(std::move(other.successorKey_))
+{
+    other.root = nullptr;
+    other.dimension = 0;
+}
+
+PLQT &PLQT::operator=(PLQT &&other) noexcept
+{
+    if (this != &other)
+    {
+        deleteTree(root);
+        root = other.root;
+        dimension = other.dimension;
+        powerOfTwo = other.powerOfTwo;
+        successorKey_ = std::move(other.successorKey_);
+        other.root = nullptr;
+        other.dimension = 0;
+    }
+    return *this;
+}
+
 PLQT::~PLQT()
 {
-    delete root;
+    deleteTree(root);
+}
+
+void PLQT::deleteTree(PLQTNode *node)
+{
+    // Iterative so that long sibling chains cannot overflow the stack.
+    std::vector<PLQTNode *> pending;
+    if (node != nullptr)
+    {
+        pending.push_back(node);
+    }
+
+    while (!pending.empty())
+    {
+        PLQTNode *current = pending.back();
+        pending.pop_back();
+
+        if (current->getFirstChild() != nullptr)
+        {
+            pending.push_back(current->getFirstChild());
+        }
+        if (current->getNextSibling() != nullptr)
+        {
+            pending.push_back(current->getNextSibling());
+        }
+        delete current;
+    }
 }
 
 PLQTNode *PLQT::insert(const std::vector<int> &data)
@@ -30,48 +83,69 @@ PLQTNode *PLQT::insert(const std::vector<int> &data)
         throw std::invalid_argument("Data vector size must match the dimension of the PLQT.");
     }
 
+    CFLP_COUNT(PlqtInserts);
+    CFLP_ALLOCATION_SCOPE(Plqt);
+    if (root == nullptr)
+    {
+        root = new PLQTNode(data);
+        return root;
+    }
+
     return insertNode(root, data);
 }
 
-int PLQT::calculateSuccessorship(PLQTNode *node, const std::vector<int> &data) const
+void PLQT::calculateSuccessorship(PLQTNode *node, const std::vector<int> &data) const
 {
-    std::vector<int> phi = std::vector<int>(dimension, 0);
+    const std::vector<int> &nodeData = node->getData();
 
-    for (int i = 0; i < dimension; ++i)
+    for (size_t w = 0; w < successorKey_.size(); ++w)
     {
-        phi[i] = node->getData()[i] <= data[i] ? 0 : 1;
+        int begin = static_cast<int>(w) * 64;
+        int end = std::min(dimension, begin + 64);
+
+        uint64_t word = 0;
+        for (int i = begin; i < end; ++i)
+        {
+            if (nodeData[i] > data[i])
+            {
+                word |= powerOfTwo.getPower(i - begin);
+            }
+        }
+        successorKey_[w] = word;
     }
+}
 
-    int successor = 0;
-    for (int i = 0; i < dimension; ++i)
+bool PLQT::isZeroSuccessor() const
+{
+    for (uint64_t word : successorKey_)
     {
-        successor += phi[i] * powerOfTwo.getPower(i);
+        if (word != 0)
+        {
+            return false;
+        }
     }
-
-    return successor;
+    return true;
 }
 
 PLQTNode *PLQT::insertNode(PLQTNode *current, const std::vector<int> &data)
 {
+    CFLP_COUNT(PlqtInsertDepth);
     if (current == nullptr)
     {
         return new PLQTNode(data);
     }
 
-    int successor = calculateSuccessorship(current, data);
+    calculateSuccessorship(current, data);
+    const uint64_t *successor = successorKey_.data();
+    size_t words = successorKey_.size();
 
-    if (successor < 0)
-    {
-        throw std::out_of_range("Successor index is out of range.");
-    }
-
-    if (successor == 0 && current->getData() == data)
+    if (isZeroSuccessor() && current->getData() == data)
     {
         return current;
     }
 
     if (current->getFirstChild() == nullptr ||
-        current->getFirstChild()->getSuccessorOrder() > successor)
+        current->getFirstChild()->compareSuccessor(successor, words) > 0)
     {
         PLQTNode *newChild = new PLQTNode(data);
 
@@ -79,19 +153,19 @@ PLQTNode *PLQT::insertNode(PLQTNode *current, const std::vector<int> &data)
         current->setFirstChild(newChild);
         newChild->setParent(current);
         newChild->setFirstChild(nullptr);
-        newChild->setSuccessorOrder(successor);
+        newChild->setSuccessorKey(successor, words);
         return newChild;
     }
 
     PLQTNode *firstChild = current->getFirstChild();
     
     while (firstChild->getNextSibling() != nullptr &&
-           firstChild->getNextSibling()->getSuccessorOrder() <= successor)
+           firstChild->getNextSibling()->compareSuccessor(successor, words) <= 0)
     {
         firstChild = firstChild->getNextSibling();
     }
 
-    if (firstChild->getSuccessorOrder() == successor)
+    if (firstChild->compareSuccessor(successor, words) == 0)
     {
         return insertNode(firstChild, data);
     }
@@ -102,7 +176,7 @@ PLQTNode *PLQT::insertNode(PLQTNode *current, const std::vector<int> &data)
         firstChild->setNextSibling(newChild);
         newChild->setParent(current);
         newChild->setFirstChild(nullptr);
-        newChild->setSuccessorOrder(successor);
+        newChild->setSuccessorKey(successor, words);
         return newChild;
     }
 }
@@ -114,26 +188,52 @@ PLQTNode *PLQT::search(const std::vector<int> &data) const
         throw std::invalid_argument("Data vector size must match the dimension of the PLQT.");
     }
 
+    CFLP_COUNT(PlqtProbes);
+    CFLP_ALLOCATION_SCOPE(Plqt);
     return searchNode(root, data);
 }
 
-PLQTNode *PLQT::searchNode(PLQTNode *node, const std::vector<int> &data) const
+std::optional<int64_t> PLQT::lookupCost(const std::vector<int> &data) const
 {
-    if (node == nullptr)
-        return nullptr;
-
-    if (node->getData() == data)
+    PLQTNode *node = search(data);
+    if (node == nullptr || !node->hasCost())
     {
-        return node;
+        return std::nullopt;
     }
+    return node->getCost();
+}
 
-    PLQTNode *found = searchNode(node->getFirstChild(), data);
-    if (found != nullptr)
+PLQTNode *PLQT::searchNode(PLQTNode *node, const std::vector<int> &data) const
+{
+    // Follows the same successorship path used by insertNode, so only the
+    // nodes on the branch that could hold the data are visited.
+    while (node != nullptr)
     {
-        return found;
+        CFLP_COUNT(PlqtProbeDepth);
+        if (node->getData() == data)
+        {
+            return node;
+        }
+
+        calculateSuccessorship(node, data);
+        const uint64_t *successor = successorKey_.data();
+        size_t words = successorKey_.size();
+
+        PLQTNode *child = node->getFirstChild();
+        while (child != nullptr && child->compareSuccessor(successor, words) < 0)
+        {
+            child = child->getNextSibling();
+        }
+
+        if (child == nullptr || child->compareSuccessor(successor, words) != 0)
+        {
+            return nullptr;
+        }
+
+        node = child;
     }
 
-    return searchNode(node->getNextSibling(), data);
+    return nullptr;
 }
 
 int PLQT::getDimension() const {
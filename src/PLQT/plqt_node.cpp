@@ -1,13 +1,23 @@
 #include "PLQT/plqt_node.h"
 #include <sstream>
+#include <algorithm>
 
 PLQTNode::PLQTNode(const std::vector<int>& data)
-    : data_(data), parent_(nullptr), nextSibling_(nullptr), firstChild_(nullptr), successorOrder_(0) {}
+    : data_(data), parent_(nullptr), nextSibling_(nullptr), firstChild_(nullptr), successorOrder_(0),
+      hasCost_(false), cost_(0), fingerprint_(0) {}
 
-std::vector<int> PLQTNode::getData() const {
+const std::vector<int>& PLQTNode::getData() const {
     return data_;
 }
 
+size_t PLQTNode::getDimension() const {
+    return data_.size();
+}
+
+int PLQTNode::getValue(size_t i) const {
+    return data_[i];
+}
+
 void PLQTNode::setData(const std::vector<int>& data) {
     data_ = data;
 }
@@ -37,11 +47,75 @@ void PLQTNode::setFirstChild(PLQTNode* child) {
 }
 
 int PLQTNode::getSuccessorOrder() const {
-    return successorOrder_;
+    return static_cast<int>(successorOrder_);
 }
 
 void PLQTNode::setSuccessorOrder(int order) {
-    successorOrder_ = order;
+    successorOrder_ = static_cast<uint64_t>(order);
+    successorHigh_.clear();
+}
+
+uint64_t PLQTNode::getSuccessorWord(size_t w) const {
+    if (w == 0) {
+        return successorOrder_;
+    }
+    return w - 1 < successorHigh_.size() ? successorHigh_[w - 1] : 0;
+}
+
+size_t PLQTNode::getSuccessorWordCount() const {
+    return 1 + successorHigh_.size();
+}
+
+void PLQTNode::setSuccessorKey(const uint64_t* words, size_t count) {
+    successorOrder_ = count > 0 ? words[0] : 0;
+    if (count > 1) {
+        successorHigh_.assign(words + 1, words + count);
+    } else {
+        successorHigh_.clear();
+    }
+}
+
+int PLQTNode::compareSuccessor(const uint64_t* words, size_t count) const {
+    size_t w = std::max(count, getSuccessorWordCount());
+    while (w-- > 0) {
+        uint64_t mine = getSuccessorWord(w);
+        uint64_t theirs = w < count ? words[w] : 0;
+        if (mine != theirs) {
+            return mine < theirs ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+bool PLQTNode::hasSameSuccessor(const PLQTNode& other) const {
+    size_t count = std::max(getSuccessorWordCount(), other.getSuccessorWordCount());
+    for (size_t w = 0; w < count; ++w) {
+        if (getSuccessorWord(w) != other.getSuccessorWord(w)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PLQTNode::hasCost() const {
+    return hasCost_;
+}
+
+int64_t PLQTNode::getCost() const {
+    return cost_;
+}
+
+void PLQTNode::setCost(int64_t cost) {
+    cost_ = cost;
+    hasCost_ = true;
+}
+
+uint64_t PLQTNode::getFingerprint() const {
+    return fingerprint_;
+}
+
+void PLQTNode::setFingerprint(uint64_t fingerprint) {
+    fingerprint_ = fingerprint;
 }
 
 bool PLQTNode::operator==(const PLQTNode& other) const {
@@ -53,12 +127,12 @@ bool PLQTNode::isStructurallyEqual(const PLQTNode& other) const {
            parent_ == other.parent_ &&
            nextSibling_ == other.nextSibling_ &&
            firstChild_ == other.firstChild_ &&
-           successorOrder_ == other.successorOrder_;
+           hasSameSuccessor(other);
 }
 
 bool PLQTNode::isDeepEqual(const PLQTNode& other) const {
     // Compare data and structural properties
-    if (data_ != other.data_ || successorOrder_ != other.successorOrder_)
+    if (data_ != other.data_ || !hasSameSuccessor(other))
         return false;
     
     // Recursively compare children
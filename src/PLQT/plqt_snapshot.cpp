@@ -0,0 +1,357 @@
+#include "PLQT/plqt_snapshot.h"
+#include "Utils/checked_arithmetic.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace
+{
+    const char kMagic[8] = {'P', 'L', 'Q', 'T', 'S', 'N', 'P', '\0'};
+    // Versión 2: la clave de sucesión de 64 bits reemplaza al successorOrder int32 de la versión 1
+    // Versión 3: la cabecera guarda la huella de la instancia
+    const uint32_t kVersion = 3;
+}
+
+void PLQTSnapshot::write(const PLQT &tree, const std::string &path, uint64_t instance)
+{
+    if (tree.getRoot() == nullptr)
+    {
+        throw std::invalid_argument("Cannot snapshot an empty PLQT.");
+    }
+
+    // Pre-order numbering of the nodes
+    std::vector<const PLQTNode *> order;
+    std::vector<const PLQTNode *> pending = {tree.getRoot()};
+    while (!pending.empty())
+    {
+        const PLQTNode *node = pending.back();
+        pending.pop_back();
+        order.push_back(node);
+
+        if (node->getNextSibling() != nullptr)
+        {
+            pending.push_back(node->getNextSibling());
+        }
+        if (node->getFirstChild() != nullptr)
+        {
+            pending.push_back(node->getFirstChild());
+        }
+    }
+
+    std::unordered_map<const PLQTNode *, uint32_t> index;
+    index.reserve(order.size());
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        index[order[i]] = static_cast<uint32_t>(i);
+    }
+
+    auto indexOf = [&index](const PLQTNode *node)
+    {
+        return node == nullptr ? kNoNode : index.at(node);
+    };
+
+    size_t dimension = static_cast<size_t>(tree.getDimension());
+    bool packed = true;
+    for (const PLQTNode *node : order)
+    {
+        for (int value : node->getData())
+        {
+            packed = packed && (value == 0 || value == 1);
+        }
+    }
+
+    Header header;
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.dimension = static_cast<uint32_t>(dimension);
+    header.nodeCount = order.size();
+    header.packed = packed ? 1 : 0;
+    header.wordsPerNode = static_cast<uint32_t>(packed ? (dimension + 63) / 64 : 0);
+    header.instance = instance;
+
+    std::vector<NodeRecord> records(order.size());
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        const PLQTNode *node = order[i];
+        NodeRecord &record = records[i];
+        record.parent = indexOf(node->getParent());
+        record.firstChild = indexOf(node->getFirstChild());
+        record.nextSibling = indexOf(node->getNextSibling());
+        record.hasCost = node->hasCost() ? 1 : 0;
+        record.successorLow = node->getSuccessorWord(0);
+        record.cost = node->getCost();
+        record.fingerprint = node->getFingerprint();
+    }
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+    {
+        throw std::runtime_error("Unable to write snapshot: " + path);
+    }
+
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(records.data()), records.size() * sizeof(NodeRecord));
+
+    if (packed)
+    {
+        std::vector<uint64_t> words(header.wordsPerNode);
+        for (const PLQTNode *node : order)
+        {
+            std::fill(words.begin(), words.end(), 0);
+            for (size_t i = 0; i < dimension; ++i)
+            {
+                if (node->getValue(i) == 1)
+                {
+                    words[i / 64] |= 1ULL << (i % 64);
+                }
+            }
+            out.write(reinterpret_cast<const char *>(words.data()), words.size() * sizeof(uint64_t));
+        }
+    }
+    else
+    {
+        for (const PLQTNode *node : order)
+        {
+            std::vector<int32_t> values(node->getData().begin(), node->getData().end());
+            out.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(int32_t));
+        }
+    }
+
+    size_t keyWords = (dimension + 63) / 64;
+    for (const PLQTNode *node : order)
+    {
+        for (size_t w = 1; w < keyWords; ++w)
+        {
+            uint64_t word = node->getSuccessorWord(w);
+            out.write(reinterpret_cast<const char *>(&word), sizeof(word));
+        }
+    }
+
+    if (!out)
+    {
+        throw std::runtime_error("Error while writing snapshot: " + path);
+    }
+}
+
+PLQTSnapshot::PLQTSnapshot(const std::string &path)
+    : file_(path), header_(nullptr), nodes_(nullptr), data_(nullptr), successorHigh_(nullptr), keyWords_(0)
+{
+    if (file_.size() < sizeof(Header))
+    {
+        throw std::runtime_error("Snapshot file is truncated: " + path);
+    }
+
+    header_ = reinterpret_cast<const Header *>(file_.data());
+    if (std::memcmp(header_->magic, kMagic, sizeof(kMagic)) != 0)
+    {
+        throw std::runtime_error("Not a PLQT snapshot: " + path);
+    }
+    if (header_->version != kVersion)
+    {
+        throw std::runtime_error("Unsupported PLQT snapshot version " + std::to_string(header_->version) +
+                                 " (expected " + std::to_string(kVersion) + "): " + path);
+    }
+
+    // Tamaños con aritmética comprobada: una cabecera alterada no puede dar la vuelta y pasar la validación
+    uint64_t count = header_->nodeCount;
+    keyWords_ = (header_->dimension + 63) / 64;
+    uint64_t valueBytes = header_->packed ? uint64_t(header_->wordsPerNode) * sizeof(uint64_t)
+                                          : uint64_t(header_->dimension) * sizeof(int32_t);
+    uint64_t recordBytes = 0, dataBytes = 0, highBytes = 0, expected = sizeof(Header);
+    bool consistent = header_->dimension > 0 && header_->packed <= 1 &&
+                      (!header_->packed || header_->wordsPerNode == keyWords_) && count > 0 && count < kNoNode &&
+                      CheckedArithmetic::multiply(count, sizeof(NodeRecord), recordBytes) &&
+                      CheckedArithmetic::multiply(count, valueBytes, dataBytes) &&
+                      CheckedArithmetic::multiply(count, (keyWords_ - 1) * sizeof(uint64_t), highBytes) &&
+                      CheckedArithmetic::add(expected, recordBytes, expected) &&
+                      CheckedArithmetic::add(expected, dataBytes, expected) &&
+                      CheckedArithmetic::add(expected, highBytes, expected);
+    if (!consistent || file_.size() != expected)
+    {
+        throw std::runtime_error("Snapshot file is truncated: " + path);
+    }
+
+    nodes_ = reinterpret_cast<const NodeRecord *>(file_.data() + sizeof(Header));
+    data_ = file_.data() + sizeof(Header) + recordBytes;
+    successorHigh_ = reinterpret_cast<const uint64_t *>(data_ + dataBytes);
+
+    // Los nodos están en pre-orden: el padre va antes y el primer hijo y el siguiente hermano después,
+    // así que find() y toTree() nunca salen del archivo ni recorren un ciclo
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        const NodeRecord &record = nodes_[i];
+        bool parentValid = i == 0 ? record.parent == kNoNode : record.parent < i;
+        auto forward = [i, count](uint32_t link) { return link == kNoNode || (link > i && link < count); };
+        if (!parentValid || !forward(record.firstChild) || !forward(record.nextSibling) || record.hasCost > 1)
+        {
+            throw std::runtime_error("Snapshot file has invalid node links: " + path);
+        }
+    }
+}
+
+uint64_t PLQTSnapshot::getInstanceFingerprint() const
+{
+    return header_->instance;
+}
+
+int PLQTSnapshot::getDimension() const
+{
+    return static_cast<int>(header_->dimension);
+}
+
+size_t PLQTSnapshot::getNodeCount() const
+{
+    return static_cast<size_t>(header_->nodeCount);
+}
+
+int PLQTSnapshot::valueAt(size_t node, size_t i) const
+{
+    if (header_->packed)
+    {
+        const uint64_t *words = reinterpret_cast<const uint64_t *>(data_) + node * header_->wordsPerNode;
+        return static_cast<int>((words[i / 64] >> (i % 64)) & 1ULL);
+    }
+    const int32_t *values = reinterpret_cast<const int32_t *>(data_) + node * header_->dimension;
+    return values[i];
+}
+
+bool PLQTSnapshot::matches(size_t node, const std::vector<int> &data) const
+{
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        if (valueAt(node, i) != data[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void PLQTSnapshot::calculateSuccessorship(size_t node, const std::vector<int> &data,
+                                          std::vector<uint64_t> &key) const
+{
+    std::fill(key.begin(), key.end(), 0);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        if (valueAt(node, i) > data[i])
+        {
+            key[i / 64] |= 1ULL << (i % 64);
+        }
+    }
+}
+
+int PLQTSnapshot::compareSuccessor(size_t node, const std::vector<uint64_t> &key) const
+{
+    size_t w = keyWords_;
+    while (w-- > 0)
+    {
+        uint64_t mine = w == 0 ? nodes_[node].successorLow : successorHigh_[node * (keyWords_ - 1) + w - 1];
+        if (mine != key[w])
+        {
+            return mine < key[w] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+uint32_t PLQTSnapshot::find(const std::vector<int> &data) const
+{
+    if (data.size() != header_->dimension)
+    {
+        throw std::invalid_argument("Data vector size must match the dimension of the snapshot.");
+    }
+
+    std::vector<uint64_t> key(keyWords_);
+
+    uint32_t node = 0;
+    while (node != kNoNode)
+    {
+        if (matches(node, data))
+        {
+            return node;
+        }
+
+        calculateSuccessorship(node, data, key);
+
+        uint32_t child = nodes_[node].firstChild;
+        while (child != kNoNode && compareSuccessor(child, key) < 0)
+        {
+            child = nodes_[child].nextSibling;
+        }
+
+        if (child == kNoNode || compareSuccessor(child, key) != 0)
+        {
+            return kNoNode;
+        }
+
+        node = child;
+    }
+
+    return kNoNode;
+}
+
+bool PLQTSnapshot::contains(const std::vector<int> &data) const
+{
+    return find(data) != kNoNode;
+}
+
+std::optional<int64_t> PLQTSnapshot::lookupCost(const std::vector<int> &data) const
+{
+    uint32_t node = find(data);
+    if (node == kNoNode || !nodes_[node].hasCost)
+    {
+        return std::nullopt;
+    }
+    return nodes_[node].cost;
+}
+
+std::vector<int> PLQTSnapshot::readData(size_t node) const
+{
+    std::vector<int> data(header_->dimension);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = valueAt(node, i);
+    }
+    return data;
+}
+
+PLQT PLQTSnapshot::toTree() const
+{
+    size_t count = getNodeCount();
+
+    std::vector<PLQTNode *> nodes(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        nodes[i] = new PLQTNode(readData(i));
+    }
+
+    auto link = [&nodes](uint32_t index)
+    {
+        return index == kNoNode ? nullptr : nodes[index];
+    };
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const NodeRecord &record = nodes_[i];
+        nodes[i]->setParent(link(record.parent));
+        nodes[i]->setFirstChild(link(record.firstChild));
+        nodes[i]->setNextSibling(link(record.nextSibling));
+        std::vector<uint64_t> key(keyWords_);
+        key[0] = record.successorLow;
+        for (size_t w = 1; w < keyWords_; ++w)
+        {
+            key[w] = successorHigh_[i * (keyWords_ - 1) + w - 1];
+        }
+        nodes[i]->setSuccessorKey(key.data(), key.size());
+        if (record.hasCost)
+        {
+            nodes[i]->setCost(record.cost);
+        }
+        nodes[i]->setFingerprint(record.fingerprint);
+    }
+
+    return PLQT(getDimension(), nodes[0]);
+}
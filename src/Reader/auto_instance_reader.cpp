@@ -0,0 +1,48 @@
+#include "Reader/auto_instance_reader.h"
+#include "Reader/beasley_instance_reader.h"
+#include "Reader/binary_instance_reader.h"
+#include "Reader/instance_format.h"
+#include "Reader/sectioned_instance_reader.h"
+
+using namespace std;
+
+AutoInstanceReader::AutoInstanceReader(int placeholderCapacity)
+    : placeholderCapacity_(placeholderCapacity) {
+}
+
+/**
+ * @brief Reads an instance from a file in any supported format.
+ * 
+ * @param filename The name of the file containing the instance data.
+ * @return Instance The read instance.
+ */
+CFLPProblem AutoInstanceReader::readInstance(const string& filename) const {
+    return readInstanceAs<int>(filename);
+}
+
+/**
+ * @brief Reads an instance in any supported format with the given cost type.
+ * 
+ * @param filename The name of the file containing the instance data.
+ * @return Instance The read instance.
+ */
+template <typename Cost>
+BasicCFLPProblem<Cost> AutoInstanceReader::readInstanceAs(const string& filename) const {
+    switch (detectInstanceFormat(filename)) {
+    case InstanceFormat::Beasley:
+        return BeasleyInstanceReader(placeholderCapacity_).readInstanceAs<Cost>(filename);
+    case InstanceFormat::Holmberg:
+        return HolmbergInstanceReader().readInstanceAs<Cost>(filename);
+    case InstanceFormat::Yang:
+        return YangInstanceReader().readInstanceAs<Cost>(filename);
+    case InstanceFormat::Tbed:
+        return TbedInstanceReader().readInstanceAs<Cost>(filename);
+    case InstanceFormat::Binary:
+        return BinaryInstanceReader().readInstanceAs<Cost>(filename);
+    }
+    throw runtime_error("Unknown instance format: " + filename);
+}
+
+template BasicCFLPProblem<int32_t> AutoInstanceReader::readInstanceAs<int32_t>(const string&) const;
+template BasicCFLPProblem<int64_t> AutoInstanceReader::readInstanceAs<int64_t>(const string&) const;
+template BasicCFLPProblem<double> AutoInstanceReader::readInstanceAs<double>(const string&) const;
@@ -1,10 +1,63 @@
 #include "Reader/beasley_instance_reader.h"
-#include <fstream>
-#include <sstream>
-#include <iostream>
+#include "Reader/text_scanner.h"
+#include "Utils/mapped_file.h"
+#include <memory>
+#include <stdexcept>
 
 using namespace std;
 
+BeasleyInstanceReader::BeasleyInstanceReader(int placeholderCapacity)
+    : placeholderCapacity_(placeholderCapacity) {
+    if (placeholderCapacity < 0) {
+        throw invalid_argument("Placeholder capacity must not be negative.");
+    }
+}
+
+/**
+ * @brief Capacity to use for the "capacity" placeholder of a file.
+ *
+ * @param filename The name of the file being read.
+ * @return The configured capacity, or the first OR-Library value for the file, or 0 if unknown.
+ */
+int BeasleyInstanceReader::resolvePlaceholderCapacity(const string& filename) const {
+    if (placeholderCapacity_ > 0) {
+        return placeholderCapacity_;
+    }
+
+    size_t slash = filename.find_last_of("/\\");
+    string stem = filename.substr(slash == string::npos ? 0 : slash + 1);
+    stem = stem.substr(0, stem.find('.'));
+
+    if (stem == "capa") return 8000;
+    if (stem == "capb") return 5000;
+    if (stem == "capc") return 5000;
+    return 0;
+}
+
+/**
+ * @brief Reads the facility counts, capacities and opening costs.
+ *
+ * @param scanner Scanner placed after the numbers of facilities and customers.
+ * @param filename The name of the file being read.
+ * @param capacities Filled with the capacity of each facility.
+ * @param openingCosts Filled with the opening cost of each facility.
+ */
+void BeasleyInstanceReader::readFacilities(TextScanner& scanner, const string& filename,
+                                           vector<int>& capacities, vector<double>& openingCosts) const {
+    for (size_t i = 0; i < capacities.size(); ++i) {
+        if (scanner.consumeWord("capacity")) {
+            int capacity = resolvePlaceholderCapacity(filename);
+            if (capacity == 0) {
+                scanner.fail("'capacity' placeholder found but no capacity value was configured");
+            }
+            capacities[i] = capacity;
+        } else {
+            capacities[i] = static_cast<int>(scanner.nextInteger("facility capacity"));
+        }
+        openingCosts[i] = scanner.nextDouble("facility opening cost");
+    }
+}
+
 /**
  * @brief Reads a Beasley instance from a file.
  * 
@@ -12,33 +65,114 @@ using namespace std;
  * @return Instance The read instance.
  */
 CFLPProblem BeasleyInstanceReader::readInstance(const string& filename) const {
-    ifstream file(filename);
-    if (!file.is_open()) {
-        throw runtime_error("Unable to open file");
-    }
+    return readInstanceAs<int>(filename);
+}
+
+/**
+ * @brief Reads a Beasley instance from a file with the given cost type.
+ * 
+ * @param filename The name of the file containing the instance data.
+ * @return Instance The read instance.
+ */
+template <typename Cost>
+BasicCFLPProblem<Cost> BeasleyInstanceReader::readInstanceAs(const string& filename) const {
+    MappedFile file(filename);
+    TextScanner scanner(file.data(), file.data() + file.size(), filename);
 
-    int numFacilities, numCustomers;
-    file >> numFacilities >> numCustomers;
+    long long numFacilities = scanner.nextInteger("number of facilities");
+    long long numCustomers = scanner.nextInteger("number of customers");
+    if (numFacilities <= 0 || numCustomers <= 0) {
+        scanner.fail("the numbers of facilities and customers must be positive");
+    }
 
     vector<int> facilityCapacities(numFacilities);
     vector<double> openingCosts(numFacilities);
-    for (int i = 0; i < numFacilities; ++i) {
-        file >> facilityCapacities[i] >> openingCosts[i];
-    }
+    readFacilities(scanner, filename, facilityCapacities, openingCosts);
 
     vector<int> customerDemands(numCustomers);
-    vector<vector<int>> transportationCosts(numFacilities, vector<int>(numCustomers));
-    for (int j = 0; j < numCustomers; ++j) {
-        file >> customerDemands[j];
-        for (int i = 0; i < numFacilities; ++i) {
-            file >> transportationCosts[i][j];
+    vector<vector<Cost>> transportationCosts(numFacilities, vector<Cost>(numCustomers));
+    for (long long j = 0; j < numCustomers; ++j) {
+        customerDemands[j] = static_cast<int>(scanner.nextInteger("customer demand"));
+        for (long long i = 0; i < numFacilities; ++i) {
+            transportationCosts[i][j] = CostTraits<Cost>::fromDecimal(scanner.nextDouble("transportation cost"));
         }
     }
 
-    return CFLPProblem(
+    if (!scanner.atEnd()) {
+        scanner.fail("unexpected data after the last customer");
+    }
+
+    return BasicCFLPProblem<Cost>(
         std::move(transportationCosts),
         std::move(facilityCapacities),
         std::move(customerDemands),
         std::move(openingCosts)
     );
 }
+
+/**
+ * @brief Streams a Beasley instance into a sparse cost matrix.
+ * 
+ * @param filename The name of the file containing the instance data.
+ * @param neighbors Number of cheapest facilities kept per customer.
+ * @return Instance The read instance.
+ */
+template <typename Cost>
+BasicSparseInstance<Cost> BeasleyInstanceReader::readSparseInstanceAs(const string& filename, size_t neighbors) const {
+    auto file = make_shared<MappedFile>(filename);
+    TextScanner scanner(file->data(), file->data() + file->size(), filename);
+
+    long long numFacilities = scanner.nextInteger("number of facilities");
+    long long numCustomers = scanner.nextInteger("number of customers");
+    if (numFacilities <= 0 || numCustomers <= 0) {
+        scanner.fail("the numbers of facilities and customers must be positive");
+    }
+    if (neighbors == 0) {
+        throw invalid_argument("At least one neighbor per customer must be kept.");
+    }
+
+    BasicSparseInstance<Cost> instance{vector<int>(numFacilities), vector<int>(numCustomers),
+                                       vector<double>(numFacilities),
+                                       BasicSparseCostMatrix<Cost>(numFacilities, neighbors)};
+    readFacilities(scanner, filename, instance.capacities, instance.openingCosts);
+
+    // Posición y línea del bloque de costos de cada cliente, para releerlo bajo demanda
+    vector<size_t> blockOffsets(numCustomers);
+    vector<size_t> blockLines(numCustomers);
+    vector<Cost> column(numFacilities);
+    for (long long j = 0; j < numCustomers; ++j) {
+        instance.demands[j] = static_cast<int>(scanner.nextInteger("customer demand"));
+        blockLines[j] = scanner.line();
+        blockOffsets[j] = static_cast<size_t>(scanner.position() - file->data());
+        for (long long i = 0; i < numFacilities; ++i) {
+            column[i] = CostTraits<Cost>::fromDecimal(scanner.nextDouble("transportation cost"));
+        }
+        instance.costs.appendCustomer(column);
+    }
+
+    if (!scanner.atEnd()) {
+        scanner.fail("unexpected data after the last customer");
+    }
+
+    instance.costs.setColumnLoader(
+        [file, filename, numFacilities, blockOffsets = std::move(blockOffsets),
+         blockLines = std::move(blockLines)](size_t customer) {
+            TextScanner block(file->data() + blockOffsets[customer], file->data() + file->size(),
+                              filename, blockLines[customer]);
+            vector<Cost> costs(numFacilities);
+            for (long long i = 0; i < numFacilities; ++i) {
+                costs[i] = CostTraits<Cost>::fromDecimal(block.nextDouble("transportation cost"));
+            }
+            return costs;
+        });
+
+    return instance;
+}
+
+template BasicCFLPProblem<int32_t> BeasleyInstanceReader::readInstanceAs<int32_t>(const string&) const;
+template BasicCFLPProblem<int64_t> BeasleyInstanceReader::readInstanceAs<int64_t>(const string&) const;
+template BasicCFLPProblem<double> BeasleyInstanceReader::readInstanceAs<double>(const string&) const;
+
+template BasicSparseInstance<int32_t> BeasleyInstanceReader::readSparseInstanceAs<int32_t>(const string&, size_t) const;
+template BasicSparseInstance<int64_t> BeasleyInstanceReader::readSparseInstanceAs<int64_t>(const string&, size_t) const;
+template BasicSparseInstance<double> BeasleyInstanceReader::readSparseInstanceAs<double>(const string&, size_t) const;
@@ -0,0 +1,223 @@
+#include "Reader/binary_instance.h"
+#include "Utils/checked_arithmetic.h"
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    const char kMagic[8] = {'C', 'F', 'L', 'P', 'I', 'N', 'S', '\0'};
+    // Versión 2: los costos se guardan en float64 en lugar de int32
+    const uint32_t kVersion = 2;
+    const uint64_t kAlignment = 64;
+
+    uint64_t alignUp(uint64_t offset)
+    {
+        return (offset + kAlignment - 1) / kAlignment * kAlignment;
+    }
+
+    void writePadding(std::ofstream &out, uint64_t &offset)
+    {
+        static const char zeros[kAlignment] = {};
+        uint64_t aligned = alignUp(offset);
+        out.write(zeros, static_cast<std::streamsize>(aligned - offset));
+        offset = aligned;
+    }
+
+    template <typename T>
+    void writeBlock(std::ofstream &out, uint64_t &offset, const T *values, size_t count)
+    {
+        writePadding(out, offset);
+        out.write(reinterpret_cast<const char *>(values), static_cast<std::streamsize>(count * sizeof(T)));
+        offset += count * sizeof(T);
+    }
+}
+
+template <typename Cost>
+void BinaryInstance::write(const BasicCFLPProblem<Cost> &problem, const std::string &path)
+{
+    Writer writer(path, problem.getCapacities(), problem.getDemands(), problem.getOpeningCosts());
+
+    std::vector<double> buffer;
+    for (const std::vector<Cost> &row : problem.getCostMatrix())
+    {
+        buffer.resize(row.size());
+        for (size_t j = 0; j < row.size(); ++j)
+        {
+            buffer[j] = CostTraits<Cost>::toDouble(row[j]);
+        }
+        writer.appendCostRows(buffer.data(), 1);
+    }
+    writer.finish();
+}
+
+BinaryInstance::Writer::Writer(const std::string &path, const std::vector<int> &capacities,
+                               const std::vector<int> &demands, const std::vector<double> &openingCosts)
+    : path_(path), out_(path, std::ios::binary | std::ios::trunc), facilities_(capacities.size()),
+      customers_(demands.size())
+{
+    if (!out_.is_open())
+    {
+        throw std::runtime_error("Unable to write binary instance: " + path);
+    }
+    if (openingCosts.size() != capacities.size())
+    {
+        throw std::invalid_argument("Capacities and opening costs differ in size: " + path);
+    }
+
+    Header header;
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.headerSize = sizeof(Header);
+    header.facilities = facilities_;
+    header.customers = customers_;
+    header.capacitiesOffset = alignUp(sizeof(Header));
+    header.demandsOffset = alignUp(header.capacitiesOffset + facilities_ * sizeof(int32_t));
+    header.openingCostsOffset = alignUp(header.demandsOffset + customers_ * sizeof(int32_t));
+    header.costsOffset = alignUp(header.openingCostsOffset + facilities_ * sizeof(double));
+
+    uint64_t offset = sizeof(Header);
+    out_.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    std::vector<int32_t> buffer(capacities.begin(), capacities.end());
+    writeBlock(out_, offset, buffer.data(), buffer.size());
+    buffer.assign(demands.begin(), demands.end());
+    writeBlock(out_, offset, buffer.data(), buffer.size());
+    writeBlock(out_, offset, openingCosts.data(), openingCosts.size());
+    writePadding(out_, offset);
+}
+
+void BinaryInstance::Writer::appendCostRows(const double *values, size_t rows)
+{
+    if (rowsWritten_ + rows > facilities_)
+    {
+        throw std::logic_error("More cost rows than facilities in " + path_);
+    }
+    out_.write(reinterpret_cast<const char *>(values),
+               static_cast<std::streamsize>(rows * customers_ * sizeof(double)));
+    rowsWritten_ += rows;
+}
+
+void BinaryInstance::Writer::finish()
+{
+    if (rowsWritten_ != facilities_)
+    {
+        throw std::logic_error("Missing cost rows in " + path_);
+    }
+    out_.close();
+    if (!out_)
+    {
+        throw std::runtime_error("Error while writing binary instance: " + path_);
+    }
+}
+
+BinaryInstance::BinaryInstance(const std::string &path)
+    : file_(path), header_(nullptr)
+{
+    if (file_.size() < sizeof(Header))
+    {
+        throw std::runtime_error("Binary instance is truncated: " + path);
+    }
+
+    header_ = reinterpret_cast<const Header *>(file_.data());
+    if (std::memcmp(header_->magic, kMagic, sizeof(kMagic)) != 0 || header_->version != kVersion ||
+        header_->headerSize != sizeof(Header))
+    {
+        throw std::runtime_error("Not a binary CFLP instance: " + path);
+    }
+
+    // Con cada dimensión acotada a INT32_MAX los bloques pequeños no desbordan; la matriz sí puede,
+    // así que su tamaño se calcula con aritmética comprobada
+    uint64_t facilities = header_->facilities;
+    uint64_t customers = header_->customers;
+    bool bounded = facilities != 0 && customers != 0 && facilities <= INT32_MAX && customers <= INT32_MAX;
+    bool aligned = header_->capacitiesOffset % kAlignment == 0 && header_->demandsOffset % kAlignment == 0 &&
+                   header_->openingCostsOffset % kAlignment == 0 && header_->costsOffset % kAlignment == 0;
+    bool ordered = bounded && header_->capacitiesOffset >= sizeof(Header) &&
+                   header_->capacitiesOffset <= file_.size() && header_->demandsOffset <= file_.size() &&
+                   header_->openingCostsOffset <= file_.size() &&
+                   header_->demandsOffset >= header_->capacitiesOffset + facilities * sizeof(int32_t) &&
+                   header_->openingCostsOffset >= header_->demandsOffset + customers * sizeof(int32_t) &&
+                   header_->costsOffset >= header_->openingCostsOffset + facilities * sizeof(double);
+    uint64_t costBytes = 0;
+    uint64_t expected = 0;
+    bool sized = ordered && CheckedArithmetic::multiply(facilities, customers, costBytes) &&
+                 CheckedArithmetic::multiply(costBytes, sizeof(double), costBytes) &&
+                 CheckedArithmetic::add(header_->costsOffset, costBytes, expected);
+    if (!aligned || !sized || file_.size() != expected)
+    {
+        throw std::runtime_error("Binary instance is truncated: " + path);
+    }
+}
+
+template <typename T>
+const T *BinaryInstance::block(uint64_t offset) const
+{
+    return reinterpret_cast<const T *>(file_.data() + offset);
+}
+
+size_t BinaryInstance::getFacilityCount() const
+{
+    return static_cast<size_t>(header_->facilities);
+}
+
+size_t BinaryInstance::getCustomerCount() const
+{
+    return static_cast<size_t>(header_->customers);
+}
+
+const int32_t *BinaryInstance::getCapacities() const
+{
+    return block<int32_t>(header_->capacitiesOffset);
+}
+
+const int32_t *BinaryInstance::getDemands() const
+{
+    return block<int32_t>(header_->demandsOffset);
+}
+
+const double *BinaryInstance::getOpeningCosts() const
+{
+    return block<double>(header_->openingCostsOffset);
+}
+
+const double *BinaryInstance::getCostRow(size_t facility) const
+{
+    return block<double>(header_->costsOffset) + facility * header_->customers;
+}
+
+CFLPProblem BinaryInstance::toProblem() const
+{
+    return toProblemAs<int>();
+}
+
+template <typename Cost>
+BasicCFLPProblem<Cost> BinaryInstance::toProblemAs() const
+{
+    size_t facilities = getFacilityCount();
+    size_t customers = getCustomerCount();
+
+    std::vector<std::vector<Cost>> costs(facilities, std::vector<Cost>(customers));
+    for (size_t i = 0; i < facilities; ++i)
+    {
+        const double *row = getCostRow(i);
+        for (size_t j = 0; j < customers; ++j)
+        {
+            costs[i][j] = CostTraits<Cost>::fromDecimal(row[j]);
+        }
+    }
+
+    return BasicCFLPProblem<Cost>(std::move(costs),
+                                  std::vector<int>(getCapacities(), getCapacities() + facilities),
+                                  std::vector<int>(getDemands(), getDemands() + customers),
+                                  std::vector<double>(getOpeningCosts(), getOpeningCosts() + facilities));
+}
+
+template void BinaryInstance::write<int32_t>(const BasicCFLPProblem<int32_t> &, const std::string &);
+template void BinaryInstance::write<int64_t>(const BasicCFLPProblem<int64_t> &, const std::string &);
+template void BinaryInstance::write<double>(const BasicCFLPProblem<double> &, const std::string &);
+template BasicCFLPProblem<int32_t> BinaryInstance::toProblemAs<int32_t>() const;
+template BasicCFLPProblem<int64_t> BinaryInstance::toProblemAs<int64_t>() const;
+template BasicCFLPProblem<double> BinaryInstance::toProblemAs<double>() const;
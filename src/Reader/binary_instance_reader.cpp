@@ -0,0 +1,27 @@
+#include "Reader/binary_instance_reader.h"
+#include "Reader/binary_instance.h"
+
+/**
+ * @brief Reads an instance from a binary file.
+ * 
+ * @param filename The name of the file containing the instance data.
+ * @return Instance The read instance.
+ */
+CFLPProblem BinaryInstanceReader::readInstance(const string& filename) const {
+    return BinaryInstance(filename).toProblem();
+}
+
+/**
+ * @brief Reads an instance from a binary file with the given cost type.
+ * 
+ * @param filename The name of the file containing the instance data.
+ * @return Instance The read instance.
+ */
+template <typename Cost>
+BasicCFLPProblem<Cost> BinaryInstanceReader::readInstanceAs(const string& filename) const {
+    return BinaryInstance(filename).toProblemAs<Cost>();
+}
+
+template BasicCFLPProblem<int32_t> BinaryInstanceReader::readInstanceAs<int32_t>(const string&) const;
+template BasicCFLPProblem<int64_t> BinaryInstanceReader::readInstanceAs<int64_t>(const string&) const;
+template BasicCFLPProblem<double> BinaryInstanceReader::readInstanceAs<double>(const string&) const;
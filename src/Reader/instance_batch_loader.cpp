@@ -0,0 +1,106 @@
+#include "Reader/instance_batch_loader.h"
+#include "Reader/auto_instance_reader.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fnmatch.h>
+#include <stdexcept>
+
+using namespace std;
+
+vector<string> InstanceBatchLoader::listFiles(const string& directoryOrPattern) {
+    namespace fs = std::filesystem;
+
+    fs::path directory = directoryOrPattern;
+    string pattern = "*";
+    if (!fs::is_directory(directory)) {
+        pattern = directory.filename().string();
+        directory = directory.parent_path();
+        if (directory.empty()) {
+            directory = ".";
+        }
+        if (!fs::is_directory(directory)) {
+            throw runtime_error("Instance directory not found: " + directory.string());
+        }
+    }
+
+    vector<string> files;
+    for (const auto& entry : fs::directory_iterator(directory)) {
+        string name = entry.path().filename().string();
+        if (entry.is_regular_file() && name[0] != '.' && fnmatch(pattern.c_str(), name.c_str(), 0) == 0) {
+            files.push_back(entry.path().string());
+        }
+    }
+    sort(files.begin(), files.end());
+    return files;
+}
+
+InstanceBatchLoader::InstanceBatchLoader(vector<string> paths, unsigned threads, Loader loader)
+    : paths_(std::move(paths)), loader_(std::move(loader)) {
+    sort(paths_.begin(), paths_.end());
+    start(threads);
+}
+
+InstanceBatchLoader::InstanceBatchLoader(const string& directoryOrPattern, unsigned threads, Loader loader)
+    : InstanceBatchLoader(listFiles(directoryOrPattern), threads, std::move(loader)) {
+}
+
+InstanceBatchLoader::~InstanceBatchLoader() {
+    next_ = paths_.size();
+    for (thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+void InstanceBatchLoader::start(unsigned threads) {
+    if (!loader_) {
+        loader_ = [reader = AutoInstanceReader()](const string& path) { return reader.readInstance(path); };
+    }
+
+    promises_.resize(paths_.size());
+    futures_.reserve(paths_.size());
+    for (promise<CFLPProblem>& slot : promises_) {
+        futures_.push_back(slot.get_future());
+    }
+
+    if (threads == 0) {
+        threads = max(1u, thread::hardware_concurrency());
+    }
+    threads = static_cast<unsigned>(min<size_t>(threads, paths_.size()));
+    workers_.reserve(threads);
+    for (unsigned t = 0; t < threads; ++t) {
+        workers_.emplace_back(&InstanceBatchLoader::work, this);
+    }
+}
+
+void InstanceBatchLoader::work() {
+    // Los archivos se reparten en orden, así que los primeros terminan primero
+    for (size_t index = next_++; index < paths_.size(); index = next_++) {
+        try {
+            promises_[index].set_value(loader_(paths_[index]));
+        } catch (...) {
+            promises_[index].set_exception(current_exception());
+        }
+    }
+}
+
+size_t InstanceBatchLoader::size() const {
+    return paths_.size();
+}
+
+const string& InstanceBatchLoader::getPath(size_t index) const {
+    return paths_.at(index);
+}
+
+bool InstanceBatchLoader::isReady(size_t index) const {
+    const future<CFLPProblem>& result = futures_.at(index);
+    return result.valid() && result.wait_for(chrono::seconds(0)) == future_status::ready;
+}
+
+CFLPProblem InstanceBatchLoader::get(size_t index) {
+    future<CFLPProblem>& result = futures_.at(index);
+    if (!result.valid()) {
+        throw future_error(future_errc::future_already_retrieved);
+    }
+    return result.get();
+}
@@ -0,0 +1,123 @@
+#include "Reader/instance_format.h"
+#include "Reader/text_scanner.h"
+#include "Utils/mapped_file.h"
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief Walks a buffer line by line, counting whitespace-separated tokens.
+ */
+class LineShape {
+public:
+    LineShape(const char* begin, const char* end) : current_(begin), end_(end) {}
+
+    /** @brief Returns the token count of the next non-blank line, or 0 at the end. */
+    size_t nextLine() {
+        while (current_ < end_) {
+            size_t tokens = 0;
+            bool inToken = false;
+            while (current_ < end_ && *current_ != '\n') {
+                bool space = *current_ == ' ' || *current_ == '\t' || *current_ == '\r' ||
+                             *current_ == '\f' || *current_ == '\v';
+                if (!space && !inToken) {
+                    ++tokens;
+                }
+                inToken = !space;
+                ++current_;
+            }
+            if (current_ < end_) {
+                ++current_;
+            }
+            if (tokens > 0) {
+                return tokens;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Skips whole lines until at least count tokens have been passed.
+     * @return true if the last skipped line ended exactly after count tokens.
+     */
+    bool skipTokens(size_t count) {
+        size_t seen = 0;
+        while (seen < count) {
+            size_t tokens = nextLine();
+            if (tokens == 0) {
+                return false;
+            }
+            seen += tokens;
+        }
+        return seen == count;
+    }
+
+private:
+    const char* current_;
+    const char* end_;
+};
+
+} // namespace
+
+string toString(InstanceFormat format) {
+    switch (format) {
+    case InstanceFormat::Beasley: return "beasley";
+    case InstanceFormat::Holmberg: return "holmberg";
+    case InstanceFormat::Yang: return "yang";
+    case InstanceFormat::Tbed: return "tbed";
+    case InstanceFormat::Binary: return "binary";
+    }
+    return "unknown";
+}
+
+InstanceFormat detectInstanceFormat(const char* begin, const char* end, const string& source) {
+    const char magic[] = "CFLPINS";
+    if (static_cast<size_t>(end - begin) >= sizeof(magic) && memcmp(begin, magic, sizeof(magic)) == 0) {
+        return InstanceFormat::Binary;
+    }
+
+    TextScanner scanner(begin, end, source);
+    long long facilities = scanner.nextInteger("number of facilities");
+    long long customers = scanner.nextInteger("number of customers");
+    if (facilities <= 0 || customers <= 0) {
+        scanner.fail("the numbers of facilities and customers must be positive");
+    }
+    size_t m = static_cast<size_t>(facilities);
+    size_t n = static_cast<size_t>(customers);
+
+    LineShape lines(begin, end);
+    if (lines.nextLine() != 2) {
+        scanner.fail("the first line must hold only the numbers of facilities and customers");
+    }
+    if (lines.nextLine() != 2) {
+        return InstanceFormat::Tbed;
+    }
+    for (size_t i = 1; i < m; ++i) {
+        lines.nextLine();
+    }
+
+    // Beasley: la demanda sola en su renglón, seguida de un renglón de costos
+    size_t first = lines.nextLine();
+    if (first == 1) {
+        size_t second = lines.nextLine();
+        if (second > 1 || m == 1) {
+            return InstanceFormat::Beasley;
+        }
+        if (n == 1) {
+            return InstanceFormat::Holmberg;
+        }
+        first = 2;
+    }
+    if (first > n || !lines.skipTokens(n - first)) {
+        return InstanceFormat::Holmberg;
+    }
+
+    size_t row = lines.nextLine();
+    return row == m && m != n ? InstanceFormat::Yang : InstanceFormat::Holmberg;
+}
+
+InstanceFormat detectInstanceFormat(const string& filename) {
+    MappedFile file(filename);
+    return detectInstanceFormat(file.data(), file.data() + file.size(), filename);
+}
@@ -0,0 +1,107 @@
+#include "Reader/sectioned_instance_reader.h"
+#include "Reader/text_scanner.h"
+#include "Utils/mapped_file.h"
+#include <stdexcept>
+
+using namespace std;
+
+SectionedInstanceReader::SectionedInstanceReader(InstanceFormat format)
+    : format_(format) {
+    if (format != InstanceFormat::Holmberg && format != InstanceFormat::Yang && format != InstanceFormat::Tbed) {
+        throw invalid_argument("Not a sectioned instance format: " + toString(format));
+    }
+}
+
+HolmbergInstanceReader::HolmbergInstanceReader()
+    : SectionedInstanceReader(InstanceFormat::Holmberg) {
+}
+
+YangInstanceReader::YangInstanceReader()
+    : SectionedInstanceReader(InstanceFormat::Yang) {
+}
+
+TbedInstanceReader::TbedInstanceReader()
+    : SectionedInstanceReader(InstanceFormat::Tbed) {
+}
+
+/**
+ * @brief Reads an instance from a file.
+ * 
+ * @param filename The name of the file containing the instance data.
+ * @return Instance The read instance.
+ */
+CFLPProblem SectionedInstanceReader::readInstance(const string& filename) const {
+    return readInstanceAs<int>(filename);
+}
+
+/**
+ * @brief Reads an instance from a file with the given cost type.
+ * 
+ * @param filename The name of the file containing the instance data.
+ * @return Instance The read instance.
+ */
+template <typename Cost>
+BasicCFLPProblem<Cost> SectionedInstanceReader::readInstanceAs(const string& filename) const {
+    MappedFile file(filename);
+    TextScanner scanner(file.data(), file.data() + file.size(), filename);
+
+    long long numFacilities = scanner.nextInteger("number of facilities");
+    long long numCustomers = scanner.nextInteger("number of customers");
+    if (numFacilities <= 0 || numCustomers <= 0) {
+        scanner.fail("the numbers of facilities and customers must be positive");
+    }
+
+    vector<int> facilityCapacities(numFacilities);
+    vector<double> openingCosts(numFacilities);
+    vector<int> customerDemands(numCustomers);
+
+    if (format_ == InstanceFormat::Tbed) {
+        for (long long j = 0; j < numCustomers; ++j) {
+            customerDemands[j] = static_cast<int>(scanner.nextInteger("customer demand"));
+        }
+        for (long long i = 0; i < numFacilities; ++i) {
+            facilityCapacities[i] = static_cast<int>(scanner.nextInteger("facility capacity"));
+        }
+        for (long long i = 0; i < numFacilities; ++i) {
+            openingCosts[i] = scanner.nextDouble("facility opening cost");
+        }
+    } else {
+        for (long long i = 0; i < numFacilities; ++i) {
+            facilityCapacities[i] = static_cast<int>(scanner.nextInteger("facility capacity"));
+            openingCosts[i] = scanner.nextDouble("facility opening cost");
+        }
+        for (long long j = 0; j < numCustomers; ++j) {
+            customerDemands[j] = static_cast<int>(scanner.nextInteger("customer demand"));
+        }
+    }
+
+    vector<vector<Cost>> transportationCosts(numFacilities, vector<Cost>(numCustomers));
+    if (format_ == InstanceFormat::Yang) {
+        for (long long j = 0; j < numCustomers; ++j) {
+            for (long long i = 0; i < numFacilities; ++i) {
+                transportationCosts[i][j] = CostTraits<Cost>::fromDecimal(scanner.nextDouble("transportation cost"));
+            }
+        }
+    } else {
+        for (long long i = 0; i < numFacilities; ++i) {
+            for (long long j = 0; j < numCustomers; ++j) {
+                transportationCosts[i][j] = CostTraits<Cost>::fromDecimal(scanner.nextDouble("transportation cost"));
+            }
+        }
+    }
+
+    if (!scanner.atEnd()) {
+        scanner.fail("unexpected data after the cost matrix");
+    }
+
+    return BasicCFLPProblem<Cost>(
+        std::move(transportationCosts),
+        std::move(facilityCapacities),
+        std::move(customerDemands),
+        std::move(openingCosts)
+    );
+}
+
+template BasicCFLPProblem<int32_t> SectionedInstanceReader::readInstanceAs<int32_t>(const string&) const;
+template BasicCFLPProblem<int64_t> SectionedInstanceReader::readInstanceAs<int64_t>(const string&) const;
+template BasicCFLPProblem<double> SectionedInstanceReader::readInstanceAs<double>(const string&) const;
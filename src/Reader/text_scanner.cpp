@@ -0,0 +1,124 @@
+#include "Reader/text_scanner.h"
+#include <charconv>
+#include <stdexcept>
+
+TextScanner::TextScanner(const char *begin, const char *end, std::string source, size_t line)
+    : current_(begin), end_(end), source_(std::move(source)), line_(line)
+{
+}
+
+void TextScanner::skipWhitespace()
+{
+    while (current_ < end_)
+    {
+        char c = *current_;
+        if (c == '\n')
+        {
+            ++line_;
+        }
+        else if (c != ' ' && c != '\t' && c != '\r' && c != '\f' && c != '\v')
+        {
+            return;
+        }
+        ++current_;
+    }
+}
+
+bool TextScanner::atEnd()
+{
+    skipWhitespace();
+    return current_ >= end_;
+}
+
+size_t TextScanner::line()
+{
+    skipWhitespace();
+    return line_;
+}
+
+const char *TextScanner::position()
+{
+    skipWhitespace();
+    return current_;
+}
+
+std::string_view TextScanner::peekToken()
+{
+    skipWhitespace();
+    const char *tokenEnd = current_;
+    while (tokenEnd < end_ && *tokenEnd != ' ' && *tokenEnd != '\t' && *tokenEnd != '\n' &&
+           *tokenEnd != '\r' && *tokenEnd != '\f' && *tokenEnd != '\v')
+    {
+        ++tokenEnd;
+    }
+    return std::string_view(current_, static_cast<size_t>(tokenEnd - current_));
+}
+
+bool TextScanner::consumeWord(std::string_view word)
+{
+    std::string_view token = peekToken();
+    if (token != word)
+    {
+        return false;
+    }
+    current_ += token.size();
+    return true;
+}
+
+std::string_view TextScanner::requireToken(const char *what)
+{
+    std::string_view token = peekToken();
+    if (token.empty())
+    {
+        fail(std::string("unexpected end of input, expected ") + what);
+    }
+    return token;
+}
+
+long long TextScanner::nextInteger(const char *what)
+{
+    std::string_view token = requireToken(what);
+    const char *first = token.data();
+    if (*first == '+')
+    {
+        ++first;
+    }
+
+    long long value = 0;
+    auto [ptr, ec] = std::from_chars(first, token.data() + token.size(), value);
+    if (ec != std::errc() || ptr != token.data() + token.size())
+    {
+        fail(std::string("expected ") + what + ", found '" + std::string(token) + "'");
+    }
+    current_ += token.size();
+    return value;
+}
+
+double TextScanner::nextDouble(const char *what)
+{
+    std::string_view token = requireToken(what);
+    const char *first = token.data();
+    if (*first == '+')
+    {
+        ++first;
+    }
+
+    double value = 0.0;
+    auto [ptr, ec] = std::from_chars(first, token.data() + token.size(), value);
+    if (ec != std::errc() || ptr != token.data() + token.size())
+    {
+        fail(std::string("expected ") + what + ", found '" + std::string(token) + "'");
+    }
+    current_ += token.size();
+    return value;
+}
+
+void TextScanner::fail(const std::string &message)
+{
+    throw std::runtime_error(source_ + ":" + std::to_string(line_) + ": " + message);
+}
+
+const std::string &TextScanner::source() const
+{
+    return source_;
+}
@@ -0,0 +1,114 @@
+#include "TabuSearch/concurrent_visited_set.h"
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+
+ConcurrentVisitedSet::ConcurrentVisitedSet(int dimension, size_t shardCount)
+    : dimension_(dimension)
+{
+    if (dimension <= 0)
+    {
+        throw std::invalid_argument("Dimension must be greater than 0.");
+    }
+    if (shardCount == 0)
+    {
+        throw std::invalid_argument("Shard count must be greater than 0.");
+    }
+
+    size_t shards = 1;
+    while (shards < shardCount)
+    {
+        shards <<= 1;
+    }
+    shardMask_ = shards - 1;
+    shards_.reset(new Shard[shards]);
+}
+
+std::string ConcurrentVisitedSet::pack(const std::vector<int> &data) const
+{
+    if (data.size() != static_cast<size_t>(dimension_))
+    {
+        throw std::invalid_argument("Data vector size must match the dimension of the set.");
+    }
+
+    // One bit per facility; fits the small-string buffer for up to 120 facilities
+    std::string key((data.size() + 7) / 8, '\0');
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        if (data[i] != 0)
+        {
+            key[i / 8] = static_cast<char>(key[i / 8] | (1 << (i % 8)));
+        }
+    }
+    return key;
+}
+
+ConcurrentVisitedSet::Shard &ConcurrentVisitedSet::shardFor(const std::string &key) const
+{
+    size_t hash = std::hash<std::string>{}(key);
+    // Mix the high bits in so that the shard index does not reuse the bucket bits
+    return shards_[(hash ^ (hash >> 29)) & shardMask_];
+}
+
+bool ConcurrentVisitedSet::insertEntry(const std::vector<int> &data, Entry entry)
+{
+    std::string key = pack(data);
+    Shard &shard = shardFor(key);
+
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto [it, inserted] = shard.entries.try_emplace(std::move(key), entry);
+    if (!inserted && !it->second.hasCost && entry.hasCost)
+    {
+        it->second = entry;
+    }
+    return inserted;
+}
+
+bool ConcurrentVisitedSet::insert(const std::vector<int> &data)
+{
+    return insertEntry(data, {false, 0});
+}
+
+bool ConcurrentVisitedSet::insert(const std::vector<int> &data, int64_t cost)
+{
+    return insertEntry(data, {true, cost});
+}
+
+bool ConcurrentVisitedSet::contains(const std::vector<int> &data) const
+{
+    std::string key = pack(data);
+    Shard &shard = shardFor(key);
+
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.entries.find(key) != shard.entries.end();
+}
+
+std::optional<int64_t> ConcurrentVisitedSet::lookupCost(const std::vector<int> &data) const
+{
+    std::string key = pack(data);
+    Shard &shard = shardFor(key);
+
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end() || !it->second.hasCost)
+    {
+        return std::nullopt;
+    }
+    return it->second.cost;
+}
+
+size_t ConcurrentVisitedSet::size() const
+{
+    size_t total = 0;
+    for (size_t i = 0; i <= shardMask_; ++i)
+    {
+        std::shared_lock<std::shared_mutex> lock(shards_[i].mutex);
+        total += shards_[i].entries.size();
+    }
+    return total;
+}
+
+int ConcurrentVisitedSet::getDimension() const
+{
+    return dimension_;
+}
@@ -0,0 +1,62 @@
+#include "TabuSearch/convergence_trace.h"
+#include <stdexcept>
+
+ConvergenceTrace::ConvergenceTrace(size_t capacity) : buffer_(capacity)
+{
+}
+
+void ConvergenceTrace::writeCsvHeader(std::ostream &out)
+{
+    out << "iteration,facility,move,tabu,zk,z0,z00\n";
+}
+
+size_t ConvergenceTrace::writeCsv(std::ostream &out)
+{
+    return drain([&out](const TraceEvent &event)
+    {
+        out << event.iteration << ',' << event.facility << ',' << (event.opened ? "open" : "close") << ','
+            << (event.tabu ? 1 : 0) << ',' << event.zk << ',' << event.z0 << ',' << event.z00 << '\n';
+    });
+}
+
+uint64_t ConvergenceTrace::getDropped() const
+{
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+size_t ConvergenceTrace::getCapacity() const
+{
+    return buffer_.capacity();
+}
+
+TraceDumper::TraceDumper(ConvergenceTrace &trace, const std::string &path, std::chrono::milliseconds interval)
+    : trace_(trace), out_(path, std::ios::trunc), interval_(interval)
+{
+    if (!out_)
+    {
+        throw std::runtime_error("Unable to write convergence trace: " + path);
+    }
+    ConvergenceTrace::writeCsvHeader(out_);
+    worker_ = std::thread(&TraceDumper::run, this);
+}
+
+TraceDumper::~TraceDumper()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_one();
+    worker_.join();
+    trace_.writeCsv(out_);
+}
+
+void TraceDumper::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_)
+    {
+        wake_.wait_for(lock, interval_, [this] { return stop_; });
+        trace_.writeCsv(out_);
+    }
+}
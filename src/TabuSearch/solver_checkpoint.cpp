@@ -0,0 +1,390 @@
+#include "TabuSearch/solver_checkpoint.h"
+#include "PLQT/plqt_node.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace
+{
+    const char kMagic[8] = {'C', 'F', 'L', 'P', 'C', 'K', 'P', 'T'};
+    // Versión 2: la huella de la instancia sigue a los tamaños
+    const uint32_t kVersion = 2;
+
+    size_t wordsFor(size_t dimension)
+    {
+        return (dimension + 63) / 64;
+    }
+
+    std::vector<uint64_t> packBits(const std::vector<int> &values)
+    {
+        std::vector<uint64_t> words(wordsFor(values.size()), 0);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            if (values[i] == 1)
+            {
+                words[i / 64] |= 1ULL << (i % 64);
+            }
+            else if (values[i] != 0)
+            {
+                throw std::invalid_argument("Only 0/1 vectors can be checkpointed.");
+            }
+        }
+        return words;
+    }
+
+    std::vector<int> unpackBits(const std::vector<uint64_t> &words, size_t dimension)
+    {
+        std::vector<int> values(dimension);
+        for (size_t i = 0; i < dimension; ++i)
+        {
+            values[i] = static_cast<int>((words[i / 64] >> (i % 64)) & 1ULL);
+        }
+        return values;
+    }
+
+    /// Escritura secuencial de valores en formato nativo, como PLQTSnapshot
+    class Writer
+    {
+    public:
+        explicit Writer(std::ofstream &out) : out_(out) {}
+
+        template <typename T>
+        void value(T item) { out_.write(reinterpret_cast<const char *>(&item), sizeof(T)); }
+
+        template <typename T>
+        void array(const std::vector<T> &items)
+        {
+            out_.write(reinterpret_cast<const char *>(items.data()), items.size() * sizeof(T));
+        }
+
+        void bits(const std::vector<int> &values) { array(packBits(values)); }
+
+        void ints(const std::vector<int> &values) { array(std::vector<int32_t>(values.begin(), values.end())); }
+
+    private:
+        std::ofstream &out_;
+    };
+
+    class Reader
+    {
+    public:
+        Reader(std::ifstream &in, const std::string &path) : in_(in), path_(path)
+        {
+            in_.seekg(0, std::ios::end);
+            size_ = static_cast<uint64_t>(in_.tellg());
+            in_.seekg(0, std::ios::beg);
+        }
+
+        /// Bytes que quedan por leer; acota los conteos del archivo antes de reservar memoria
+        uint64_t remaining() { return size_ - static_cast<uint64_t>(in_.tellg()); }
+
+        void expect(uint64_t count, uint64_t bytesEach)
+        {
+            if (bytesEach != 0 && count > remaining() / bytesEach)
+            {
+                throw std::runtime_error("Truncated checkpoint: " + path_);
+            }
+        }
+
+        template <typename T>
+        T value()
+        {
+            T item;
+            read(&item, sizeof(T));
+            return item;
+        }
+
+        template <typename T>
+        std::vector<T> array(uint64_t count)
+        {
+            expect(count, sizeof(T));
+            std::vector<T> items(count);
+            read(items.data(), count * sizeof(T));
+            return items;
+        }
+
+        std::vector<int> bits(size_t dimension) { return unpackBits(array<uint64_t>(wordsFor(dimension)), dimension); }
+
+        std::vector<int> ints(size_t count)
+        {
+            std::vector<int32_t> items = array<int32_t>(count);
+            return std::vector<int>(items.begin(), items.end());
+        }
+
+        void read(void *data, size_t size)
+        {
+            if (!in_.read(static_cast<char *>(data), size))
+            {
+                throw std::runtime_error("Truncated checkpoint: " + path_);
+            }
+        }
+
+    private:
+        std::ifstream &in_;
+        const std::string &path_;
+        uint64_t size_ = 0;
+    };
+}
+
+std::vector<SolverCheckpoint::MemoryNode> SolverCheckpoint::captureMemory(const PLQT &tree)
+{
+    std::vector<MemoryNode> nodes;
+    std::vector<const PLQTNode *> pending;
+    if (tree.getRoot() != nullptr)
+    {
+        pending.push_back(tree.getRoot());
+    }
+    while (!pending.empty())
+    {
+        const PLQTNode *node = pending.back();
+        pending.pop_back();
+        nodes.push_back({packBits(node->getData()), node->hasCost(), node->getCost(), node->getFingerprint()});
+
+        if (node->getNextSibling() != nullptr)
+        {
+            pending.push_back(node->getNextSibling());
+        }
+        if (node->getFirstChild() != nullptr)
+        {
+            pending.push_back(node->getFirstChild());
+        }
+    }
+    return nodes;
+}
+
+PLQT SolverCheckpoint::restoreMemory() const
+{
+    if (memory.empty())
+    {
+        return PLQT();
+    }
+
+    // Reinsertar en pre-orden reproduce el árbol: cada nodo encuentra ya a sus ancestros
+    PLQT tree(static_cast<int>(facilities), new PLQTNode(unpackBits(memory[0].bits, facilities)));
+    for (size_t i = 0; i < memory.size(); ++i)
+    {
+        const MemoryNode &saved = memory[i];
+        PLQTNode *node = i == 0 ? tree.getRoot() : tree.insert(unpackBits(saved.bits, facilities));
+        if (saved.hasCost)
+        {
+            node->setCost(saved.cost);
+        }
+        node->setFingerprint(saved.fingerprint);
+    }
+    return tree;
+}
+
+void SolverCheckpoint::write(const std::string &path) const
+{
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        if (!out.is_open())
+        {
+            throw std::runtime_error("Unable to write checkpoint: " + path);
+        }
+        Writer writer(out);
+        out.write(kMagic, sizeof(kMagic));
+        writer.value(kVersion);
+        writer.value(facilities);
+        writer.value(customers);
+        writer.value(instance);
+        for (int32_t counter : {k, k0, c, c0, l0, l1})
+        {
+            writer.value(counter);
+        }
+        for (int64_t cost : {z0, zk, z00})
+        {
+            writer.value(cost);
+        }
+        writer.value(elapsed);
+        writer.value(timeToBest);
+        writer.value(static_cast<uint64_t>(generator.size()));
+        out.write(generator.data(), generator.size());
+
+        for (const std::vector<int> *solution : {&y, &yBest, &yP2, &yP3})
+        {
+            if (solution->size() != facilities)
+            {
+                throw std::invalid_argument("Checkpoint vectors must have one value per facility.");
+            }
+            writer.bits(*solution);
+        }
+        writer.ints(t);
+        writer.ints(h);
+
+        writer.value(static_cast<uint64_t>(memory.size()));
+        for (const MemoryNode &node : memory)
+        {
+            writer.value(static_cast<uint32_t>(node.hasCost ? 1 : 0));
+            writer.value(node.cost);
+            writer.value(node.fingerprint);
+            writer.array(node.bits);
+        }
+        out.write(kMagic, sizeof(kMagic));
+
+        if (!out)
+        {
+            throw std::runtime_error("Error while writing checkpoint: " + path);
+        }
+    }
+    if (std::rename(temporary.c_str(), path.c_str()) != 0)
+    {
+        throw std::runtime_error("Unable to replace checkpoint: " + path);
+    }
+}
+
+SolverCheckpoint SolverCheckpoint::read(const std::string &path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open())
+    {
+        throw std::runtime_error("Unable to open checkpoint: " + path);
+    }
+    Reader reader(in, path);
+
+    char magic[sizeof(kMagic)];
+    reader.read(magic, sizeof(magic));
+    if (std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 || reader.value<uint32_t>() != kVersion)
+    {
+        throw std::runtime_error("Not a solver checkpoint: " + path);
+    }
+
+    SolverCheckpoint checkpoint;
+    checkpoint.facilities = reader.value<uint32_t>();
+    checkpoint.customers = reader.value<uint32_t>();
+    checkpoint.instance = reader.value<uint64_t>();
+    for (int32_t *counter : {&checkpoint.k, &checkpoint.k0, &checkpoint.c, &checkpoint.c0, &checkpoint.l0,
+                             &checkpoint.l1})
+    {
+        *counter = reader.value<int32_t>();
+    }
+    for (int64_t *cost : {&checkpoint.z0, &checkpoint.zk, &checkpoint.z00})
+    {
+        *cost = reader.value<int64_t>();
+    }
+    checkpoint.elapsed = reader.value<double>();
+    checkpoint.timeToBest = reader.value<double>();
+    std::vector<char> generator = reader.array<char>(reader.value<uint64_t>());
+    checkpoint.generator.assign(generator.begin(), generator.end());
+
+    size_t m = checkpoint.facilities;
+    for (std::vector<int> *solution : {&checkpoint.y, &checkpoint.yBest, &checkpoint.yP2, &checkpoint.yP3})
+    {
+        *solution = reader.bits(m);
+    }
+    checkpoint.t = reader.ints(m);
+    checkpoint.h = reader.ints(m);
+
+    uint64_t nodes = reader.value<uint64_t>();
+    reader.expect(nodes, sizeof(uint32_t) + sizeof(int64_t) + sizeof(uint64_t) + wordsFor(m) * sizeof(uint64_t));
+    checkpoint.memory.resize(nodes);
+    for (MemoryNode &node : checkpoint.memory)
+    {
+        node.hasCost = reader.value<uint32_t>() != 0;
+        node.cost = reader.value<int64_t>();
+        node.fingerprint = reader.value<uint64_t>();
+        node.bits = reader.array<uint64_t>(wordsFor(m));
+    }
+
+    reader.read(magic, sizeof(magic));
+    if (std::memcmp(magic, kMagic, sizeof(kMagic)) != 0)
+    {
+        throw std::runtime_error("Truncated checkpoint: " + path);
+    }
+    return checkpoint;
+}
+
+CheckpointWriter::CheckpointWriter() : worker_(&CheckpointWriter::run, this)
+{
+}
+
+CheckpointWriter::~CheckpointWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    changed_.notify_all();
+    worker_.join();
+}
+
+bool CheckpointWriter::isIdle()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !busy_;
+}
+
+bool CheckpointWriter::submit(SolverCheckpoint checkpoint, const std::string &path)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (busy_)
+        {
+            return false;
+        }
+        pending_ = std::move(checkpoint);
+        path_ = path;
+        busy_ = true;
+    }
+    changed_.notify_all();
+    return true;
+}
+
+void CheckpointWriter::wait()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    changed_.wait(lock, [this] { return !busy_; });
+    if (!error_.empty())
+    {
+        std::string error = error_;
+        error_.clear();
+        throw std::runtime_error(error);
+    }
+}
+
+size_t CheckpointWriter::getWrittenCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return written_;
+}
+
+void CheckpointWriter::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        changed_.wait(lock, [this] { return stop_ || pending_.has_value(); });
+        if (!pending_)
+        {
+            return;
+        }
+        SolverCheckpoint checkpoint = std::move(*pending_);
+        pending_.reset();
+        std::string path = path_;
+
+        lock.unlock();
+        std::string error;
+        try
+        {
+            checkpoint.write(path);
+        }
+        catch (const std::exception &failure)
+        {
+            error = failure.what();
+        }
+        lock.lock();
+
+        busy_ = false;
+        if (error.empty())
+        {
+            ++written_;
+        }
+        else
+        {
+            error_ = error;
+        }
+        changed_.notify_all();
+    }
+}
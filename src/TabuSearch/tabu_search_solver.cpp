@@ -1,25 +1,36 @@
 #include "TabuSearch/tabu_search_solver.h"
 #include "PLQT/plqt_node.h"
+#include "PLQT/plqt_snapshot.h"
 #include "ContinuousKnapsackProblem/continuous_item.h"
 #include "ContinuousKnapsackProblem/continuous_knapsack.h"
+#include "Utils/instrumentation.h"
 #include <algorithm>
+#include <numeric>
 #include <cmath>
 #include <chrono>
 #include <iostream>
 #include <functional>
-
-using namespace std;
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
 
 namespace
 {
-    const unsigned int seed = 12345;
-
-    std::mt19937 gen(seed);
-
-    std::uniform_int_distribution<int> dist_l0(l0_l, l0_u);
-    std::uniform_int_distribution<int> dist_l1(l1_l, l1_u);
+    /// Recupera el generador guardado en un punto de control
+    std::mt19937 parseGenerator(const std::string &state)
+    {
+        std::istringstream in(state);
+        std::mt19937 generator;
+        if (!(in >> generator))
+        {
+            throw std::runtime_error("Checkpoint holds an invalid generator state.");
+        }
+        return generator;
+    }
 }
 
+using namespace std;
+
 TabuSearchSolver::TabuSearchSolver(CFLPProblem &problem)
     : problem(problem), m(problem.getCapacities().size())
 {
@@ -27,14 +38,259 @@ TabuSearchSolver::TabuSearchSolver(CFLPProblem &problem)
     y_best.resize(m, 0);
     t.resize(m, 0);
     h.resize(m, 0);
+    maxIterations = 20 * m;
     plqt_ = PLQT();
 }
 
 void TabuSearchSolver::solve()
 {
-    initialize();
-    mainSearchProcess();
+    instanceFingerprint_ = problem.getInstanceFingerprint();
+    start_ = std::chrono::steady_clock::now();
+    timeToBest_ = 0.0;
+    Instrumentation::Report before = Instrumentation::threadReport();
+    MemoryAccounting::ThreadMeter meter;
+    {
+        CFLP_ALLOCATION_SCOPE(Solver);
+        if (resume_)
+        {
+            restore();
+        }
+        else
+        {
+            initialize();
+        }
+        solving_ = true;
+        lastCheckpoint_ = std::chrono::steady_clock::now();
+        mainSearchProcess();
+        solving_ = false;
+        elapsed_ = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+        problem.setSolutionCache(nullptr);
+    }
+    instrumentation_ = Instrumentation::threadReport();
+    instrumentation_ -= before;
+    memoryUsage_ = meter.read();
+
+    if (checkpointWriter_ != nullptr)
+    {
+        checkpointWriter_->wait();
+    }
+}
+
+std::vector<int> TabuSearchSolver::getBestSolution() const
+{
+    return y_best;
+}
+
+double TabuSearchSolver::getBestCost() const
+{
+    return z00;
+}
+
+void TabuSearchSolver::setSeed(unsigned seed)
+{
+    gen.seed(seed);
+}
+
+void TabuSearchSolver::setTimeLimit(double seconds)
+{
+    if (seconds < 0)
+    {
+        throw std::invalid_argument("Time limit must not be negative.");
+    }
+    timeLimit_ = seconds;
+}
+
+int TabuSearchSolver::getIterationCount() const
+{
+    return k - 1;
+}
+
+double TabuSearchSolver::getTimeToBest() const
+{
+    return timeToBest_;
+}
+
+const Instrumentation::Report &TabuSearchSolver::getInstrumentation() const
+{
+    return instrumentation_;
+}
+
+void TabuSearchSolver::writeInstrumentation(const std::string &path) const
+{
+    std::ofstream out(path);
+    if (!out)
+    {
+        throw std::runtime_error("Unable to write instrumentation report: " + path);
+    }
+    instrumentation_.writeJson(out);
+    out << "\n";
+}
+
+const MemoryAccounting::Report &TabuSearchSolver::getMemoryUsage() const
+{
+    return memoryUsage_;
+}
+
+bool TabuSearchSolver::timeLimitReached() const
+{
+    return timeLimit_ > 0 &&
+           std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count() >= timeLimit_;
+}
+
+const PLQT &TabuSearchSolver::getMemory() const
+{
+    return plqt_;
+}
+
+void TabuSearchSolver::setSharedMemory(ConcurrentVisitedSet *shared)
+{
+    if (shared != nullptr && shared->getDimension() != m)
+    {
+        throw std::invalid_argument("Shared memory dimension must match the number of facilities.");
+    }
+    sharedMemory_ = shared;
+}
+
+void TabuSearchSolver::setTrace(ConvergenceTrace *trace)
+{
+    trace_ = trace;
+}
+
+void TabuSearchSolver::saveMemory(const std::string &path) const
+{
+    PLQTSnapshot::write(plqt_, path, problem.getInstanceFingerprint());
+}
+
+void TabuSearchSolver::restoreMemory(const std::string &path)
+{
+    PLQTSnapshot snapshot(path);
+    if (snapshot.getDimension() != m)
+    {
+        throw std::invalid_argument("Snapshot dimension must match the number of facilities.");
+    }
+    // Los costos memorizados solo valen para la instancia que los calculó
+    if (snapshot.getInstanceFingerprint() != problem.getInstanceFingerprint())
+    {
+        throw std::invalid_argument("Snapshot was written for another instance: " + path);
+    }
+    plqt_ = snapshot.toTree();
+    memoryRestored_ = true;
+}
+
+SolverCheckpoint TabuSearchSolver::getCheckpoint() const
+{
+    SolverCheckpoint checkpoint;
+    checkpoint.facilities = m;
+    checkpoint.customers = problem.getDemands().size();
+    checkpoint.instance = solving_ ? instanceFingerprint_ : problem.getInstanceFingerprint();
+    checkpoint.k = k;
+    checkpoint.k0 = k0;
+    checkpoint.c = c;
+    checkpoint.c0 = c0;
+    checkpoint.l0 = l0;
+    checkpoint.l1 = l1;
+    checkpoint.z0 = z0;
+    checkpoint.zk = zk;
+    checkpoint.z00 = z00;
+    checkpoint.elapsed = solving_ ? std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count()
+                                  : elapsed_;
+    checkpoint.timeToBest = timeToBest_;
+
+    std::ostringstream generator;
+    generator << gen;
+    checkpoint.generator = generator.str();
+
+    checkpoint.y = y;
+    checkpoint.yBest = y_best;
+    checkpoint.yP2 = y_P2;
+    checkpoint.yP3 = y_P3;
+    checkpoint.t = t;
+    checkpoint.h = h;
+    checkpoint.memory = SolverCheckpoint::captureMemory(plqt_);
+    return checkpoint;
+}
+
+void TabuSearchSolver::saveCheckpoint(const std::string &path) const
+{
+    getCheckpoint().write(path);
+}
+
+void TabuSearchSolver::enableCheckpoints(const std::string &path, double intervalSeconds)
+{
+    if (intervalSeconds < 0)
+    {
+        throw std::invalid_argument("Checkpoint interval must not be negative.");
+    }
+    if (checkpointWriter_ == nullptr)
+    {
+        checkpointWriter_ = std::make_unique<CheckpointWriter>();
+    }
+    checkpointPath_ = path;
+    checkpointInterval_ = intervalSeconds;
+}
+
+void TabuSearchSolver::resume(const std::string &path)
+{
+    SolverCheckpoint checkpoint = SolverCheckpoint::read(path);
+    if (static_cast<int>(checkpoint.facilities) != m || checkpoint.customers != problem.getDemands().size())
+    {
+        throw std::invalid_argument("Checkpoint sizes must match the instance.");
+    }
+    // El mejor costo y la memoria guardados solo valen para la instancia que los calculó
+    if (checkpoint.instance != problem.getInstanceFingerprint())
+    {
+        throw std::invalid_argument("Checkpoint was written for another instance: " + path);
+    }
+    parseGenerator(checkpoint.generator);
+    resume_ = std::move(checkpoint);
+}
+
+void TabuSearchSolver::checkpointIfDue()
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if (std::chrono::duration<double>(now - lastCheckpoint_).count() < checkpointInterval_ ||
+        !checkpointWriter_->isIdle())
+    {
+        return;
+    }
+    lastCheckpoint_ = now;
+    checkpointWriter_->submit(getCheckpoint(), checkpointPath_);
+}
+
+void TabuSearchSolver::setInitialSolution(const std::vector<int> &open)
+{
+    if (static_cast<int>(open.size()) != m)
+    {
+        throw std::invalid_argument("Initial solution size must match the number of facilities.");
+    }
+    for (int status : open)
+    {
+        if (status != 0 && status != 1)
+        {
+            throw std::invalid_argument("Initial solution values must be 0 or 1.");
+        }
+    }
+    y_initial = open;
+}
+
+void TabuSearchSolver::warmStart(const std::string &path)
+{
+    CFLPSolution solution = CFLPSolution::read(path);
+    if (solution.getCustomerCount() != problem.getDemands().size())
+    {
+        throw std::invalid_argument("Solution customer count must match the instance.");
+    }
+    setInitialSolution(solution.getOpenFacilities());
+}
+
+CFLPSolution TabuSearchSolver::getSolution(bool withAssignments)
+{
+    return CFLPSolution::evaluate(problem, y_best, withAssignments);
+}
 
+void TabuSearchSolver::saveSolution(const std::string &path, bool withAssignments)
+{
+    getSolution(withAssignments).write(path);
 }
 
 void TabuSearchSolver::computePriorities()
@@ -111,6 +367,28 @@ void TabuSearchSolver::initialize()
     }
     y_P3 = y;
 
+    // Arranque en caliente: partir de la solución dada, completada en el orden de P3 si no cubre la demanda
+    if (!y_initial.empty())
+    {
+        y = y_initial;
+        y_initial.clear(); // solo vale para este solve(), como resume_
+        total_capacity = 0.0;
+        for (int i = 0; i < m; ++i)
+        {
+            total_capacity += y[i] * a[i];
+        }
+        for (int i : I3_)
+        {
+            if (total_capacity >= total_demand)
+                break;
+            if (y[i] == 0)
+            {
+                y[i] = 1;
+                total_capacity += a[i];
+            }
+        }
+    }
+
     y_P2.assign(m, 0);
     double total_capacity_P2 = 0.0;
     for (int i : I2_)
@@ -128,9 +406,10 @@ void TabuSearchSolver::initialize()
 
     z0 = problem.getCurrentCost();
     z00 = z0;
+    zk = z0;
 
-    l0 = dist_l0(gen);
-    l1 = dist_l1(gen);
+    l0 = std::uniform_int_distribution<int>(l0_l, l0_u)(gen);
+    l1 = std::uniform_int_distribution<int>(l1_l, l1_u)(gen);
 
     for (int i = 0; i < m; ++i)
     {
@@ -148,7 +427,68 @@ void TabuSearchSolver::initialize()
 
     y_best = y;
     m1 = std::count(y.begin(), y.end(), 1);
-    plqt_ = PLQT(m, new PLQTNode(y));
+    PLQTNode *start;
+    if (memoryRestored_)
+    {
+        start = plqt_.insert(y);
+    }
+    else
+    {
+        plqt_ = PLQT(m, new PLQTNode(y));
+        start = plqt_.getRoot();
+    }
+    start->setCost(z0);
+    start->setFingerprint(problem.getSubproblem().getAssignmentFingerprint());
+    if (sharedMemory_ != nullptr)
+    {
+        sharedMemory_->insert(y, z0);
+    }
+    problem.setSolutionCache(&plqt_);
+}
+
+void TabuSearchSolver::restore()
+{
+    computePriorities();
+    const SolverCheckpoint &saved = *resume_;
+
+    y = saved.y;
+    y_best = saved.yBest;
+    y_P2 = saved.yP2;
+    y_P3 = saved.yP3;
+    t = saved.t;
+    h = saved.h;
+    k = saved.k;
+    k0 = saved.k0;
+    c = saved.c;
+    c0 = saved.c0;
+    l0 = saved.l0;
+    l1 = saved.l1;
+    z0 = saved.z0;
+    zk = saved.zk;
+    z00 = saved.z00;
+    gen = parseGenerator(saved.generator);
+
+    problem.initializeSubproblem(y);
+    currentSupply = problem.getCurrentTotalSupply();
+    totalDemand_ = problem.getTotalDemand();
+    m1 = std::count(y.begin(), y.end(), 1);
+
+    // El tiempo ya buscado cuenta para el límite de tiempo
+    start_ -= std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(saved.elapsed));
+    timeToBest_ = saved.timeToBest;
+
+    plqt_ = saved.restoreMemory();
+    if (plqt_.getRoot() == nullptr)
+    {
+        plqt_ = PLQT(m, new PLQTNode(y));
+    }
+    if (sharedMemory_ != nullptr)
+    {
+        sharedMemory_->insert(y, zk);
+    }
+    problem.setSolutionCache(&plqt_);
+    resume_.reset();
 }
 
 bool TabuSearchSolver::isFeasibleToClose(int i)
@@ -162,6 +502,12 @@ bool TabuSearchSolver::isFeasibleToClose(int i)
 
 void TabuSearchSolver::mainSearchProcess()
 {
+    CFLP_PHASE_SCOPE(MainSearch);
+    if (k > maxIterations || timeLimitReached())
+    {
+        return;
+    }
+
     evaluateNeighborhood();
 
     if (alpha1 * m < k0)
@@ -177,6 +523,11 @@ void TabuSearchSolver::mainSearchProcess()
 void TabuSearchSolver::handleTabuMove()
 {
     determineBestFacility();
+    if (bestFacility == -1)
+    {
+        return; // Ningún movimiento admisible en el vecindario
+    }
+
     if (!isTabu(bestFacility))
     {
         executeMove(bestFacility);
@@ -192,7 +543,7 @@ void TabuSearchSolver::handleTabuMove()
         }
         else
         {
-            deltaZ_values[bestFacility] = std::numeric_limits<int>::max();
+            deltaZ_values[bestFacility] = std::numeric_limits<int64_t>::max();
             handleTabuMove();
         }
     }
@@ -200,20 +551,31 @@ void TabuSearchSolver::handleTabuMove()
 
 void TabuSearchSolver::determineBestFacility()
 {
-    bestDelta = numeric_limits<int>::max();
-    bestFacility = -1;
-    for (int i : deltaZ_values)
+    // Una cota inferior solo se resuelve si llega a ser la mejor: el elegido es el mismo que con valores exactos
+    while (true)
     {
-        if (deltaZ_values[i] < bestDelta)
+        bestDelta = numeric_limits<int64_t>::max();
+        bestFacility = -1;
+        for (int i : bar_I)
         {
-            bestDelta = deltaZ_values[i];
-            bestFacility = i;
+            if (deltaZ_values[i] < bestDelta)
+            {
+                bestDelta = deltaZ_values[i];
+                bestFacility = i;
+            }
         }
+        if (bestFacility == -1 || deltaExact_[bestFacility])
+        {
+            return;
+        }
+        deltaZ_values[bestFacility] = computeDeltaZ(bestFacility);
+        deltaExact_[bestFacility] = 1;
     }
 }
 
 void TabuSearchSolver::executeMove(int i)
 {
+    bool wasTabu = trace_ != nullptr && isTabu(i);
     if (y[i] == 1)
     {
         m1--;
@@ -231,10 +593,26 @@ void TabuSearchSolver::executeMove(int i)
         h[i] = h[i] + k - t[i];
     }
 
+    y[i] = 1 - y[i];
     problem.toggleFacility(i);
     zk = problem.getCurrentCost();
     currentSupply = problem.getCurrentTotalSupply();
-    plqt_.insert(y);
+
+    if (sharedMemory_ != nullptr)
+    {
+        sharedMemory_->insert(y, zk);
+    }
+
+    // Memorizar el costo para que las visitas posteriores no resuelvan el transporte
+    PLQTNode *node = plqt_.insert(y);
+    if (!node->hasCost())
+    {
+        node->setCost(zk);
+        if (!problem.isTransportStale())
+        {
+            node->setFingerprint(problem.getSubproblem().getAssignmentFingerprint());
+        }
+    }
 
     if (zk < z0)
     {
@@ -246,6 +624,17 @@ void TabuSearchSolver::executeMove(int i)
     {
         z00 = z0;
         y_best = y;
+        timeToBest_ = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+    }
+
+    if (trace_ != nullptr)
+    {
+        trace_->record({k, i, zk, z0, z00, y[i] == 1, wasTabu});
+    }
+
+    if (checkpointWriter_ != nullptr)
+    {
+        checkpointIfDue();
     }
 
     if (k - k0 < (alpha1 - alpha2) * m)
@@ -254,21 +643,81 @@ void TabuSearchSolver::executeMove(int i)
     }
 }
 
+bool TabuSearchSolver::isVisited(const std::vector<int> &candidate) const
+{
+    if (plqt_.search(candidate) != nullptr)
+    {
+        return true;
+    }
+    return sharedMemory_ != nullptr && sharedMemory_->contains(candidate);
+}
+
 bool TabuSearchSolver::isTabu(int i)
 {
     return (k - t[i]) <= h[i];
 }
 
-bool TabuSearchSolver::aspirationCriterion(int deltaZ)
+bool TabuSearchSolver::aspirationCriterion(int64_t deltaZ)
 {
+    if (deltaZ == std::numeric_limits<int64_t>::max())
+    {
+        return false;
+    }
     return (zk + deltaZ) < z0;
 }
 
+int64_t TabuSearchSolver::boundDeltaZ(int i, int64_t cutoff)
+{
+    if (y[i] == 1 && !isFeasibleToClose(i))
+    {
+        deltaExact_[i] = 1;
+        return std::numeric_limits<int64_t>::max();
+    }
+
+    // Solo interesa si el vecino mejora el corte; si no puede, basta la cota inferior
+    int64_t current = problem.getCurrentCost();
+    int64_t limit = cutoff == std::numeric_limits<int64_t>::max() ? cutoff : current + cutoff;
+    deltaExact_[i] = problem.toggleFacility(i, limit) ? 1 : 0;
+    int64_t candidate = problem.getCurrentCost();
+    problem.toggleFacility(i);
+
+    return candidate - current;
+}
+
+int64_t TabuSearchSolver::computeDeltaZ(int i)
+{
+    if (y[i] == 1 && !isFeasibleToClose(i))
+    {
+        return std::numeric_limits<int64_t>::max();
+    }
+
+    // Evaluar el vecino y regresar; el regreso usa el costo memorizado en la PLQT
+    int64_t current = problem.getCurrentCost();
+    problem.toggleFacility(i);
+    int64_t candidate = problem.getCurrentCost();
+    problem.toggleFacility(i);
+
+    return candidate - current;
+}
+
+double TabuSearchSolver::computeDeltaZ_altering(int i)
+{
+    int64_t deltaZ = computeDeltaZ(i);
+    if (deltaZ == std::numeric_limits<int64_t>::max())
+    {
+        return std::numeric_limits<double>::max();
+    }
+
+    // Criterio alterado: variación del costo por unidad de capacidad
+    return static_cast<double>(deltaZ) / problem.getCapacities()[i];
+}
+
 void TabuSearchSolver::determineNeighborhood()
 {
     bar_I.clear();
-    int startIndex = ((k - 1) * bar_m) % m;
-    for (int i = 0; i < bar_m; ++i)
+    int size = std::min(bar_m, m);
+    int startIndex = ((k - 1) * size) % m;
+    for (int i = 0; i < size; ++i)
     {
         int index = (startIndex + i) % m;
         bar_I.push_back(index);
@@ -279,10 +728,17 @@ void TabuSearchSolver::evaluateNeighborhood()
 {
     determineNeighborhood();
 
+    // Un vecino que no puede mejorar al mejor ya evaluado se descarta con su cota
     deltaZ_values.assign(m, 0);
+    deltaExact_.assign(m, 1);
+    int64_t best = std::numeric_limits<int64_t>::max();
     for (int i : bar_I)
     {
-        deltaZ_values[i] = computeDeltaZ(i); // no implementada
+        deltaZ_values[i] = boundDeltaZ(i, best);
+        if (deltaExact_[i])
+        {
+            best = std::min(best, deltaZ_values[i]);
+        }
     }
 }
 
@@ -295,6 +751,7 @@ void TabuSearchSolver::intensification()
 
 void TabuSearchSolver::criterionAltering()
 {
+    CFLP_PHASE_SCOPE(Altering);
     // Step 5
     evaluateNeighborhoodAltering(); // no implementada
 
@@ -321,9 +778,9 @@ void TabuSearchSolver::evaluateNeighborhoodAltering()
 
 void TabuSearchSolver::determineBestFacilityAltering()
 {
-    bestDelta_altering = numeric_limits<int>::max();
+    bestDelta_altering = numeric_limits<double>::max();
     bestFacility = -1;
-    for (int i : deltaZ_values_altering)
+    for (int i : bar_I)
     {
         if (deltaZ_values_altering[i] < bestDelta_altering)
         {
@@ -336,19 +793,24 @@ void TabuSearchSolver::determineBestFacilityAltering()
 void TabuSearchSolver::handleTabuMoveAltering()
 {
     determineBestFacilityAltering();
+    if (bestFacility == -1)
+    {
+        return;
+    }
+
     if (!isTabu(bestFacility))
     {
         executeMove(bestFacility);
     }
     else
     {
-        if (aspirationCriterion(computeDeltaZ_altering(bestFacility)))
+        if (aspirationCriterion(computeDeltaZ(bestFacility)))
         {
             executeMove(bestFacility);
         }
         else
         {
-            deltaZ_values_altering[bestFacility] = std::numeric_limits<int>::max();
+            deltaZ_values_altering[bestFacility] = std::numeric_limits<double>::max();
             handleTabuMoveAltering();
         }
     }
@@ -356,6 +818,7 @@ void TabuSearchSolver::handleTabuMoveAltering()
 
 void TabuSearchSolver::solutionReconciling()
 {
+    CFLP_PHASE_SCOPE(Reconciling);
     // Step 9
     reconcilingY = c % 2 == 0 ? y_P2 : y_P3;
 
@@ -370,17 +833,17 @@ void TabuSearchSolver::backIndex()
 {
     std::vector<int> tempY = y;
 
-    while (tempY[finalIndex] == 0)
+    while (finalIndex >= 0 && tempY[finalIndex] == 0)
     {
         finalIndex--;
     }
 
-    if (initialIndex < finalIndex)
+    if (finalIndex >= 0 && initialIndex < finalIndex)
     {
         if (isFeasibleToClose(finalIndex))
         {
             tempY[finalIndex] = 0;
-            if (plqt_.search(tempY) != nullptr)
+            if (isVisited(tempY))
             {
                 finalIndex--;
             }
@@ -397,7 +860,7 @@ void TabuSearchSolver::advanceIndex()
 {
     std::vector<int> tempY = y;
 
-    while (tempY[initialIndex] == 1)
+    while (initialIndex < m && tempY[initialIndex] == 1)
     {
         initialIndex++;
     }
@@ -405,7 +868,7 @@ void TabuSearchSolver::advanceIndex()
     if (initialIndex < finalIndex)
     {
         tempY[initialIndex] = 1;
-        if (plqt_.search(tempY) != nullptr)
+        if (isVisited(tempY))
         {
             initialIndex++;
             advanceIndex();
@@ -420,8 +883,9 @@ void TabuSearchSolver::advanceIndex()
 
 void TabuSearchSolver::pathRelinking(const std::vector<int> &source)
 {
+    CFLP_PHASE_SCOPE(PathRelinking);
     targetSolution = y_best;
-    int targetCost = z00;
+    int64_t targetCost = z00;
 
     std::vector<int> I0T;
     std::vector<int> I1T;
@@ -442,7 +906,7 @@ void TabuSearchSolver::pathRelinking(const std::vector<int> &source)
     while (!I1T.empty())
     {
         int i = I1T.back();
-        if (isFeasibleToClose(i))
+        if (!isFeasibleToClose(i))
         {
             break;
         }
@@ -450,7 +914,7 @@ void TabuSearchSolver::pathRelinking(const std::vector<int> &source)
         std::vector<int> tempY = y;
         tempY[i] = 0; // Cerrar instalación
 
-        if (plqt_.search(tempY) == nullptr)
+        if (isVisited(tempY))
         {
             I1T.pop_back();
             continue;
@@ -461,20 +925,20 @@ void TabuSearchSolver::pathRelinking(const std::vector<int> &source)
     }
 
     // Paso 18
-    while (!I1T.empty())
+    while (!I0T.empty())
     {
-        int i = I1T.back();
+        int i = I0T.back();
 
         vector<int> tempY = y;
         tempY[i] = 1; // Abrir instalación
 
-        if (plqt_.search(tempY) == nullptr)
+        if (isVisited(tempY))
         {
-            I1T.pop_back();
+            I0T.pop_back();
             continue;
         }
 
-        I1T.pop_back();
+        I0T.pop_back();
         executeMove(i);
     }
 
@@ -492,6 +956,7 @@ void TabuSearchSolver::pathRelinking(const std::vector<int> &source)
 
 void TabuSearchSolver::diversification()
 {
+    CFLP_PHASE_SCOPE(Diversification);
     if (c > C)
     {
         return;
@@ -523,7 +988,7 @@ void TabuSearchSolver::diversification()
             std::vector<int> tempY = y;
             tempY[i] = 0;
 
-            if (plqt_.search(tempY) == nullptr)
+            if (!isVisited(tempY))
             {
                 executeMove(i);    // cerrar i
                 diversification(); // continuar desde paso 22
@@ -544,7 +1009,7 @@ void TabuSearchSolver::diversification()
             std::vector<int> tempY = y;
             tempY[i] = 1;
 
-            if (plqt_.search(tempY) == nullptr)
+            if (!isVisited(tempY))
             {
                 executeMove(i);    // abrir i
                 diversification(); // continuar desde paso 22
@@ -563,8 +1028,8 @@ void TabuSearchSolver::diversification()
         c++;
         z0 = zk;
         k0 = 1;
-        l0 = dist_l0(gen);   // Recalcular l0
-        l1 = dist_l1(gen);   // Recalcular l1
+        l0 = std::uniform_int_distribution<int>(l0_l, l0_u)(gen); // Recalcular l0
+        l1 = std::uniform_int_distribution<int>(l1_l, l1_u)(gen); // Recalcular l1
         mainSearchProcess(); // Reiniciar el proceso de búsqueda principal
     }
 }
@@ -1,12 +1,16 @@
 #include "TransportProblem/cflp_tansport_problem.h"
+#include "Utils/instrumentation.h"
+#include "Utils/memory_accounting.h"
 #include <stdexcept>
 #include <numeric>
 #include <algorithm>
+#include <limits>
 
-CFLPTransportSubproblem::CFLPTransportSubproblem(const std::vector<std::vector<int>> &fullCostMatrix,
-                                                 const std::vector<int> &capacities,
-                                                 const std::vector<int> &demands,
-                                                 const std::vector<int> &openFacilities)
+template <typename Cost>
+BasicCFLPTransportSubproblem<Cost>::BasicCFLPTransportSubproblem(const CostMatrix &fullCostMatrix,
+                                                                 const std::vector<int> &capacities,
+                                                                 const std::vector<int> &demands,
+                                                                 const std::vector<int> &openFacilities)
     : fullCostMatrix_(fullCostMatrix),
       allCapacities_(capacities),
       clientDemands_(demands),
@@ -21,7 +25,36 @@ CFLPTransportSubproblem::CFLPTransportSubproblem(const std::vector<std::vector<i
     if (!fullCostMatrix_.empty() && fullCostMatrix_[0].size() != demands.size())
         throw std::invalid_argument("Cost matrix column count must match demand size.");
 
-    totalDemand_ = std::accumulate(demands.begin(), demands.end(), 0);
+    buildFromOpenFacilities();
+}
+
+template <typename Cost>
+BasicCFLPTransportSubproblem<Cost>::BasicCFLPTransportSubproblem(BasicSparseCostMatrix<Cost> &sparseCosts,
+                                                                 const std::vector<int> &capacities,
+                                                                 const std::vector<int> &demands,
+                                                                 const std::vector<int> &openFacilities)
+    : allCapacities_(capacities),
+      clientDemands_(demands),
+      openFacilities_(openFacilities),
+      sparseCosts_(&sparseCosts),
+      totalDemand_(0),
+      transportProblem_({}, {}, {})
+{
+    if (sparseCosts.getFacilityCount() != capacities.size())
+        throw std::invalid_argument("Cost matrix row count must match capacity size.");
+    if (openFacilities_.size() != capacities.size())
+        throw std::invalid_argument("Open facilities vector size must match capacities.");
+    if (sparseCosts.getCustomerCount() != demands.size())
+        throw std::invalid_argument("Cost matrix column count must match demand size.");
+
+    buildFromOpenFacilities();
+}
+
+template <typename Cost>
+void BasicCFLPTransportSubproblem<Cost>::buildFromOpenFacilities()
+{
+    CFLP_ALLOCATION_SCOPE(Transport);
+    totalDemand_ = std::accumulate(clientDemands_.begin(), clientDemands_.end(), 0);
     transportProblem_.setTotalDemand(totalDemand_);
     totalSupply_ = 0;
 
@@ -33,27 +66,39 @@ CFLPTransportSubproblem::CFLPTransportSubproblem(const std::vector<std::vector<i
         }
     }
 
+    // Los índices se reservan para todas las instalaciones; las tablas del
+    // método húngaro solo para las abiertas y crecen cuando se abre otra
+    size_t m = openFacilities_.size();
     selectedSupplies_.clear();
     selectedCosts_.clear();
     facilityIndexMap_.clear();
+    spareCostRows_.clear();
+    selectedSupplies_.reserve(m);
+    selectedCosts_.reserve(m);
+    facilityIndexMap_.reserve(m);
+    spareCostRows_.reserve(m);
 
     // Build the subproblem with only open facilities
-    for (size_t i = 0; i < openFacilities_.size(); ++i)
+    for (size_t i = 0; i < m; ++i)
     {
         if (openFacilities_[i])
         {
             selectedSupplies_.push_back(allCapacities_[i]);
-            selectedCosts_.push_back(fullCostMatrix_[i]);
+            selectedCosts_.emplace_back();
+            loadCostRow(i, selectedCosts_.back());
             facilityIndexMap_.push_back(i);
         }
     }
+    workspace_.reserve(selectedCosts_.size(), clientDemands_.size() + 1);
 
     // Reconstruct the transportation problem
-    transportProblem_ = TransportationProblem(selectedSupplies_, clientDemands_, selectedCosts_);
+    transportProblem_.reset(selectedSupplies_, clientDemands_, selectedCosts_);
     transportProblem_.setTotalSupply(totalSupply_);
+    transportProblem_.setTotalDemand(totalDemand_);
 }
 
-CFLPTransportSubproblem::CFLPTransportSubproblem()
+template <typename Cost>
+BasicCFLPTransportSubproblem<Cost>::BasicCFLPTransportSubproblem()
     : fullCostMatrix_(),
       allCapacities_(),
       clientDemands_(),
@@ -63,7 +108,8 @@ CFLPTransportSubproblem::CFLPTransportSubproblem()
 {
 }
 
-void CFLPTransportSubproblem::toggleFacility(int facilityIndex)
+template <typename Cost>
+void BasicCFLPTransportSubproblem<Cost>::toggleFacility(int facilityIndex)
 {
     if (facilityIndex < 0 || facilityIndex >= static_cast<int>(openFacilities_.size()))
         throw std::out_of_range("Invalid facility index");
@@ -75,7 +121,16 @@ void CFLPTransportSubproblem::toggleFacility(int facilityIndex)
     if (openFacilities_[facilityIndex])
     {
         selectedSupplies_.push_back(allCapacities_[facilityIndex]);
-        selectedCosts_.push_back(fullCostMatrix_[facilityIndex]);
+        if (spareCostRows_.empty())
+        {
+            selectedCosts_.emplace_back();
+        }
+        else
+        {
+            selectedCosts_.push_back(std::move(spareCostRows_.back()));
+            spareCostRows_.pop_back();
+        }
+        loadCostRow(facilityIndex, selectedCosts_.back());
         facilityIndexMap_.push_back(facilityIndex);
     }
     else
@@ -84,80 +139,199 @@ void CFLPTransportSubproblem::toggleFacility(int facilityIndex)
         if (it != facilityIndexMap_.end())
         {
             size_t index = std::distance(facilityIndexMap_.begin(), it);
+            spareCostRows_.push_back(std::move(selectedCosts_[index]));
             selectedSupplies_.erase(selectedSupplies_.begin() + index);
             selectedCosts_.erase(selectedCosts_.begin() + index);
             facilityIndexMap_.erase(it);
         }
     }
 
-    transportProblem_ = TransportationProblem(selectedSupplies_, clientDemands_, selectedCosts_);
+    transportProblem_.reset(selectedSupplies_, clientDemands_, selectedCosts_);
     transportProblem_.setTotalSupply(totalSupply_);
     transportProblem_.setTotalDemand(totalDemand_);
 }
 
-void CFLPTransportSubproblem::solve()
+template <typename Cost>
+void BasicCFLPTransportSubproblem<Cost>::loadCostRow(size_t facility, std::vector<Cost> &row) const
+{
+    if (sparseCosts_ == nullptr)
+    {
+        row = fullCostMatrix_[facility];
+        return;
+    }
+    row.resize(clientDemands_.size());
+    for (size_t j = 0; j < row.size(); ++j)
+    {
+        row[j] = sparseCosts_->getCost(facility, j);
+    }
+}
+
+template <typename Cost>
+bool BasicCFLPTransportSubproblem<Cost>::loadInexactColumns()
+{
+    const auto &subAssign = transportProblem_.getAssignmentMatrix();
+    std::vector<size_t> loaded;
+    for (size_t sub_i = 0; sub_i < subAssign.size(); ++sub_i)
+    {
+        for (size_t j = 0; j < clientDemands_.size(); ++j)
+        {
+            if (subAssign[sub_i][j] != 0 && !sparseCosts_->isExact(facilityIndexMap_[sub_i], j) &&
+                sparseCosts_->loadColumn(j))
+            {
+                loaded.push_back(j);
+            }
+        }
+    }
+
+    for (size_t sub_i = 0; sub_i < selectedCosts_.size(); ++sub_i)
+    {
+        for (size_t j : loaded)
+        {
+            selectedCosts_[sub_i][j] = sparseCosts_->getCost(facilityIndexMap_[sub_i], j);
+        }
+    }
+    return !loaded.empty();
+}
+
+template <typename Cost>
+void BasicCFLPTransportSubproblem<Cost>::solve()
 {
+    solve(std::numeric_limits<Accumulator>::max());
+}
+
+template <typename Cost>
+bool BasicCFLPTransportSubproblem<Cost>::solve(Accumulator cutoff)
+{
+    CFLP_TIME_SCOPE(TransportSolve);
+    CFLP_ALLOCATION_SCOPE(Transport);
+    CFLP_COUNT(TransportSolves);
     transportProblem_.balance();
-    transportProblem_.solveHungarianMethod();
+    if (!transportProblem_.solveHungarianMethod(workspace_, cutoff))
+    {
+        return false;
+    }
+
+    // Las entradas descartadas valen una cota inferior; si la solución usa alguna,
+    // se cargan sus columnas exactas y se resuelve de nuevo. Con esas cotas la cota
+    // dual sigue siendo válida para los costos exactos
+    while (sparseCosts_ != nullptr && loadInexactColumns())
+    {
+        transportProblem_.reset(selectedSupplies_, clientDemands_, selectedCosts_);
+        transportProblem_.setTotalSupply(totalSupply_);
+        transportProblem_.setTotalDemand(totalDemand_);
+        transportProblem_.balance();
+        if (!transportProblem_.solveHungarianMethod(workspace_, cutoff))
+        {
+            return false;
+        }
+    }
     totalCost_ = transportProblem_.getTotalCost();
 
     // Get the assignment matrix from the subproblem
     const auto &subAssign = transportProblem_.getAssignmentMatrix();
 
-    // Map the subproblem assignments back to original indices
+    assignmentMatrix_.resize(openFacilities_.size());
+    for (auto &row : assignmentMatrix_)
+    {
+        row.assign(clientDemands_.size(), 0);
+    }
+
+    // Map the subproblem assignments back to original indices, dropping the dummy client
+    uint64_t fingerprint = 14695981039346656037ULL;
     for (size_t sub_i = 0; sub_i < subAssign.size(); ++sub_i)
     {
         size_t original_i = facilityIndexMap_[sub_i];
-        for (size_t j = 0; j < subAssign[sub_i].size(); ++j)
+        for (size_t j = 0; j < clientDemands_.size(); ++j)
         {
             assignmentMatrix_[original_i][j] = subAssign[sub_i][j];
+            if (subAssign[sub_i][j] != 0)
+            {
+                for (uint64_t word : {static_cast<uint64_t>(original_i), static_cast<uint64_t>(j),
+                                      static_cast<uint64_t>(subAssign[sub_i][j])})
+                {
+                    fingerprint = (fingerprint ^ word) * 1099511628211ULL;
+                }
+            }
         }
-    };
+    }
+    assignmentFingerprint_ = fingerprint;
 
     totalCost_ = transportProblem_.getTotalCost();
+    return true;
+}
+
+template <typename Cost>
+typename BasicCFLPTransportSubproblem<Cost>::Accumulator BasicCFLPTransportSubproblem<Cost>::getLowerBound() const
+{
+    return transportProblem_.getLowerBound();
 }
 
-int CFLPTransportSubproblem::getCurrentTotalSupply() const
+template <typename Cost>
+void BasicCFLPTransportSubproblem<Cost>::setInitialFlow(InitialFlow method)
+{
+    transportProblem_.setInitialFlow(method);
+}
+
+template <typename Cost>
+int BasicCFLPTransportSubproblem<Cost>::getCurrentTotalSupply() const
 {
     return totalSupply_;
 }
 
-int CFLPTransportSubproblem::getCurrentTotalDemand() const
+template <typename Cost>
+int BasicCFLPTransportSubproblem<Cost>::getCurrentTotalDemand() const
 {
     return totalDemand_;
 }
 
-const TransportationProblem &CFLPTransportSubproblem::getTransportProblem() const
+template <typename Cost>
+const BasicTransportationProblem<Cost> &BasicCFLPTransportSubproblem<Cost>::getTransportProblem() const
 {
     return transportProblem_;
 }
 
-const std::vector<int> &CFLPTransportSubproblem::getOpenFacilities() const
+template <typename Cost>
+const std::vector<int> &BasicCFLPTransportSubproblem<Cost>::getOpenFacilities() const
 {
     return openFacilities_;
 }
 
-const std::vector<size_t> &CFLPTransportSubproblem::getFacilityIndexMap() const
+template <typename Cost>
+const std::vector<size_t> &BasicCFLPTransportSubproblem<Cost>::getFacilityIndexMap() const
 {
     return facilityIndexMap_;
 }
 
-const std::vector<std::vector<int>> &CFLPTransportSubproblem::getAssignmentMatrix() const
+template <typename Cost>
+const std::vector<std::vector<int>> &BasicCFLPTransportSubproblem<Cost>::getAssignmentMatrix() const
 {
     return assignmentMatrix_;
 }
 
-int CFLPTransportSubproblem::getTotalCost() const
+template <typename Cost>
+typename BasicCFLPTransportSubproblem<Cost>::Accumulator BasicCFLPTransportSubproblem<Cost>::getTotalCost() const
 {
     return totalCost_;
 }
 
-int CFLPTransportSubproblem::getTotalSupply() const
+template <typename Cost>
+uint64_t BasicCFLPTransportSubproblem<Cost>::getAssignmentFingerprint() const
+{
+    return assignmentFingerprint_;
+}
+
+template <typename Cost>
+int BasicCFLPTransportSubproblem<Cost>::getTotalSupply() const
 {
     return totalSupply_;
 }
 
-int CFLPTransportSubproblem::getTotalDemand() const
+template <typename Cost>
+int BasicCFLPTransportSubproblem<Cost>::getTotalDemand() const
 {
     return totalDemand_;
-}
\ No newline at end of file
+}
+
+template class BasicCFLPTransportSubproblem<int32_t>;
+template class BasicCFLPTransportSubproblem<int64_t>;
+template class BasicCFLPTransportSubproblem<double>;
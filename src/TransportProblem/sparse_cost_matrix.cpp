@@ -0,0 +1,133 @@
+#include "TransportProblem/sparse_cost_matrix.h"
+#include <algorithm>
+#include <stdexcept>
+
+template <typename Cost>
+BasicSparseCostMatrix<Cost>::BasicSparseCostMatrix(size_t facilities, size_t neighbors)
+    : facilities_(facilities), neighbors_(std::min(neighbors, facilities)), offsets_{0}
+{
+    if (facilities == 0 || neighbors == 0)
+        throw std::invalid_argument("Sparse cost matrix needs at least one facility and one neighbor.");
+}
+
+template <typename Cost>
+void BasicSparseCostMatrix<Cost>::appendCustomer(const std::vector<Cost> &column)
+{
+    if (column.size() != facilities_)
+        throw std::invalid_argument("Cost column length must match the facility count.");
+
+    order_.resize(facilities_);
+    for (size_t i = 0; i < facilities_; ++i)
+    {
+        order_[i] = static_cast<uint32_t>(i);
+    }
+
+    auto cheaper = [&column](uint32_t a, uint32_t b)
+    {
+        return column[a] < column[b] || (column[a] == column[b] && a < b);
+    };
+    std::nth_element(order_.begin(), order_.begin() + (neighbors_ - 1), order_.end(), cheaper);
+    Cost bound = column[order_[neighbors_ - 1]];
+    std::sort(order_.begin(), order_.begin() + neighbors_);
+
+    for (size_t r = 0; r < neighbors_; ++r)
+    {
+        facilityIds_.push_back(order_[r]);
+        costs_.push_back(column[order_[r]]);
+    }
+    offsets_.push_back(facilityIds_.size());
+    bounds_.push_back(bound);
+}
+
+template <typename Cost>
+void BasicSparseCostMatrix<Cost>::setColumnLoader(ColumnLoader loader)
+{
+    loader_ = std::move(loader);
+}
+
+template <typename Cost>
+size_t BasicSparseCostMatrix<Cost>::getFacilityCount() const
+{
+    return facilities_;
+}
+
+template <typename Cost>
+size_t BasicSparseCostMatrix<Cost>::getCustomerCount() const
+{
+    return bounds_.size();
+}
+
+template <typename Cost>
+size_t BasicSparseCostMatrix<Cost>::getNeighborCount() const
+{
+    return neighbors_;
+}
+
+template <typename Cost>
+size_t BasicSparseCostMatrix<Cost>::getStoredEntryCount() const
+{
+    return facilityIds_.size();
+}
+
+template <typename Cost>
+bool BasicSparseCostMatrix<Cost>::isExact(size_t facility, size_t customer) const
+{
+    if (neighbors_ == facilities_ || loadedColumns_.count(customer) != 0)
+    {
+        return true;
+    }
+    auto first = facilityIds_.begin() + offsets_[customer];
+    auto last = facilityIds_.begin() + offsets_[customer + 1];
+    return std::binary_search(first, last, static_cast<uint32_t>(facility));
+}
+
+template <typename Cost>
+Cost BasicSparseCostMatrix<Cost>::getCost(size_t facility, size_t customer) const
+{
+    auto first = facilityIds_.begin() + offsets_[customer];
+    auto last = facilityIds_.begin() + offsets_[customer + 1];
+    auto it = std::lower_bound(first, last, static_cast<uint32_t>(facility));
+    if (it != last && *it == facility)
+    {
+        return costs_[it - facilityIds_.begin()];
+    }
+
+    auto loaded = loadedColumns_.find(customer);
+    if (loaded != loadedColumns_.end())
+    {
+        return loaded->second[facility];
+    }
+    return bounds_[customer];
+}
+
+template <typename Cost>
+std::vector<Cost> BasicSparseCostMatrix<Cost>::getRow(size_t facility) const
+{
+    std::vector<Cost> row(getCustomerCount());
+    for (size_t j = 0; j < row.size(); ++j)
+    {
+        row[j] = getCost(facility, j);
+    }
+    return row;
+}
+
+template <typename Cost>
+bool BasicSparseCostMatrix<Cost>::loadColumn(size_t customer)
+{
+    if (neighbors_ == facilities_ || loadedColumns_.count(customer) != 0)
+    {
+        return false;
+    }
+    if (!loader_)
+        throw std::logic_error("No column loader set for the sparse cost matrix.");
+
+    std::vector<Cost> column = loader_(customer);
+    if (column.size() != facilities_)
+        throw std::runtime_error("Column loader returned a column of the wrong length.");
+    loadedColumns_.emplace(customer, std::move(column));
+    return true;
+}
+
+template class BasicSparseCostMatrix<int32_t>;
+template class BasicSparseCostMatrix<int64_t>;
+template class BasicSparseCostMatrix<double>;
@@ -1,4 +1,5 @@
 #include "TransportProblem/transport_problem.h"
+#include "Utils/instrumentation.h"
 #include <stdexcept>
 #include <numeric>
 #include <algorithm>
@@ -7,9 +8,10 @@
 #include <functional>
 #include <iostream>
 
-TransportationProblem::TransportationProblem(const std::vector<int> &supply,
-                                             const std::vector<int> &demand,
-                                             const std::vector<std::vector<int>> &costMatrix)
+template <typename Cost>
+BasicTransportationProblem<Cost>::BasicTransportationProblem(const std::vector<int> &supply,
+                                                             const std::vector<int> &demand,
+                                                             const CostMatrix &costMatrix)
     : supply_(supply),
       demand_(demand),
       costMatrix_(costMatrix),
@@ -23,35 +25,129 @@ TransportationProblem::TransportationProblem(const std::vector<int> &supply,
             throw std::invalid_argument("Each cost matrix row must match demand size.");
     }
 
+    calculateTotalSupplyAndDemand();
+    initializeAssignment();
+}
+
+namespace
+{
+    /// Ajusta el número de filas moviendo las sobrantes a una reserva, para no liberar ni pedir memoria
+    template <typename T>
+    void resizeRows(std::vector<std::vector<T>> &rows, std::vector<std::vector<T>> &spare, size_t count)
+    {
+        while (rows.size() > count)
+        {
+            spare.push_back(std::move(rows.back()));
+            rows.pop_back();
+        }
+        while (rows.size() < count)
+        {
+            if (spare.empty())
+            {
+                rows.emplace_back();
+            }
+            else
+            {
+                rows.push_back(std::move(spare.back()));
+                spare.pop_back();
+            }
+        }
+    }
+}
+
+template <typename Cost>
+void BasicTransportationProblem<Cost>::setInitialFlow(InitialFlow method)
+{
+    initialFlow_ = method;
+}
+
+template <typename Cost>
+InitialFlow BasicTransportationProblem<Cost>::getInitialFlow() const
+{
+    return initialFlow_;
+}
+
+template <typename Cost>
+void BasicTransportationProblem<Cost>::reset(const std::vector<int> &supply,
+                                             const std::vector<int> &demand,
+                                             const CostMatrix &costMatrix)
+{
+    if (costMatrix.size() != supply.size())
+        throw std::invalid_argument("Cost matrix row count must match supply size.");
+    for (const auto &row : costMatrix)
+    {
+        if (row.size() != demand.size())
+            throw std::invalid_argument("Each cost matrix row must match demand size.");
+    }
+
+    supply_ = supply;
+    demand_ = demand;
+    resizeRows(costMatrix_, spareCostRows_, costMatrix.size());
+    for (size_t i = 0; i < costMatrix.size(); ++i)
+    {
+        costMatrix_[i] = costMatrix[i];
+    }
+
+    calculateTotalSupplyAndDemand();
     initializeAssignment();
 }
 
-void TransportationProblem::initializeAssignment()
+template <typename Cost>
+void BasicTransportationProblem<Cost>::initializeAssignment()
 {
-    assignmentMatrix_ = std::vector<std::vector<int>>(supply_.size(), std::vector<int>(demand_.size(), 0));
+    resizeRows(assignmentMatrix_, spareAssignmentRows_, supply_.size());
+    for (auto &row : assignmentMatrix_)
+    {
+        row.assign(demand_.size(), 0);
+    }
     totalCost_ = 0;
 }
 
-void TransportationProblem::solveHungarianMethod()
+template <typename Cost>
+void BasicTransportationProblem<Cost>::solveHungarianMethod()
+{
+    Workspace workspace;
+    solveHungarianMethod(workspace);
+}
+
+template <typename Cost>
+void BasicTransportationProblem<Cost>::solveHungarianMethod(Workspace &workspace)
+{
+    solveHungarianMethod(workspace, std::numeric_limits<Accumulator>::max());
+}
+
+template <typename Cost>
+bool BasicTransportationProblem<Cost>::solveHungarianMethod(Workspace &workspace, Accumulator cutoff)
 {
     initializeAssignment();
     checkBalancedProblem();
 
-    size_t m = supply_.size();
-    size_t n = demand_.size();
-
-    auto [agents, jobs, matrix] = initializeDataStructures(m, n);
-    preliminarReduction(agents, jobs, matrix);
+    initializeDataStructures(workspace);
+    preliminarReduction(workspace);
 
-    while (!isProblemSolved(agents, jobs))
+    // La cota dual solo crece en el paso 3; basta revisarla tras la reducción y tras cada paso
+    while (!isProblemSolved(workspace))
     {
-        executeStep1(agents, jobs, matrix);
+        if (lowerBound_ >= cutoff)
+        {
+            CFLP_COUNT(TransportCutoffs);
+            return false;
+        }
+        executeStep1(workspace);
     }
 
-    finalizeSolution(matrix);
+    finalizeSolution(workspace);
+    return true;
 }
 
-void TransportationProblem::checkBalancedProblem() const
+template <typename Cost>
+typename BasicTransportationProblem<Cost>::Accumulator BasicTransportationProblem<Cost>::getLowerBound() const
+{
+    return lowerBound_;
+}
+
+template <typename Cost>
+void BasicTransportationProblem<Cost>::checkBalancedProblem() const
 {
     if (totalSupply_ != totalDemand_)
     {
@@ -59,29 +155,65 @@ void TransportationProblem::checkBalancedProblem() const
     }
 }
 
-TransportationProblem::HungarianDataStructures TransportationProblem::initializeDataStructures(size_t m, size_t n)
+template <typename Cost>
+void BasicTransportationProblem<Cost>::Workspace::reserve(size_t agents, size_t jobs)
 {
-    HungarianDataStructures data;
+    agents_.reserve(agents);
+    jobs_.reserve(jobs);
+    if (matrix_.size() < agents)
+    {
+        matrix_.resize(agents);
+    }
+    for (auto &row : matrix_)
+    {
+        row.reserve(jobs);
+    }
+    primedSeen_.reserve(std::max(agents, jobs));
+    starredSeen_.reserve(std::max(agents, jobs));
+    lineFirst_.reserve(agents + jobs);
+    lineSecond_.reserve(agents + jobs);
+    lineCell_.reserve(agents + jobs);
+}
 
-    std::get<0>(data).resize(m);
-    std::get<1>(data).resize(n);
-    std::get<2>(data).resize(m, std::vector<MatrixEntry>(n));
+template <typename Cost>
+void BasicTransportationProblem<Cost>::Workspace::resize(size_t agents, size_t jobs)
+{
+    agents_.resize(agents);
+    jobs_.resize(jobs);
+    if (matrix_.size() < agents)
+    {
+        matrix_.resize(agents);
+    }
+    for (size_t i = 0; i < agents; ++i)
+    {
+        matrix_[i].resize(jobs);
+    }
+    primedSeen_.resize(std::max(agents, jobs));
+    starredSeen_.resize(std::max(agents, jobs));
+}
+
+template <typename Cost>
+void BasicTransportationProblem<Cost>::initializeDataStructures(Workspace &workspace)
+{
+    size_t m = supply_.size();
+    size_t n = demand_.size();
+    workspace.resize(m, n);
 
     for (size_t i = 0; i < m; ++i)
     {
-        std::get<0>(data)[i] = {false, supply_[i]};
+        workspace.agents_[i] = {false, supply_[i]};
     }
 
     for (size_t j = 0; j < n; ++j)
     {
-        std::get<1>(data)[j] = {false, demand_[j]};
+        workspace.jobs_[j] = {false, demand_[j]};
     }
 
     for (size_t i = 0; i < m; ++i)
     {
         for (size_t j = 0; j < n; ++j)
         {
-            std::get<2>(data)[i][j] = {
+            workspace.matrix_[i][j] = {
                 costMatrix_[i][j],
                 costMatrix_[i][j],
                 0,
@@ -89,30 +221,34 @@ TransportationProblem::HungarianDataStructures TransportationProblem::initialize
                 false};
         }
     }
-
-    return data;
 }
 
-void TransportationProblem::preliminarReduction(std::vector<AgentJobEntry> &agents,
-                                                std::vector<AgentJobEntry> &jobs,
-                                                std::vector<std::vector<MatrixEntry>> &matrix)
+template <typename Cost>
+void BasicTransportationProblem<Cost>::preliminarReduction(Workspace &workspace)
 {
-    for (auto &row : matrix)
+    auto &agents = workspace.agents_;
+    auto &jobs = workspace.jobs_;
+    auto &matrix = workspace.matrix_;
+
+    // Los mínimos restados son los potenciales duales iniciales u_i y v_j
+    lowerBound_ = 0;
+    for (size_t i = 0; i < agents.size(); ++i)
     {
-        int min_val = std::numeric_limits<int>::max();
-        for (const auto &entry : row)
+        Cost min_val = std::numeric_limits<Cost>::max();
+        for (const auto &entry : matrix[i])
         {
             min_val = std::min(min_val, entry.val);
         }
-        for (auto &entry : row)
+        for (auto &entry : matrix[i])
         {
             entry.val -= min_val;
         }
+        lowerBound_ += static_cast<Accumulator>(agents[i].discr) * min_val;
     }
 
     for (size_t j = 0; j < jobs.size(); ++j)
     {
-        int min_val = std::numeric_limits<int>::max();
+        Cost min_val = std::numeric_limits<Cost>::max();
         for (size_t i = 0; i < agents.size(); ++i)
         {
             min_val = std::min(min_val, matrix[i][j].val);
@@ -121,32 +257,236 @@ void TransportationProblem::preliminarReduction(std::vector<AgentJobEntry> &agen
         {
             matrix[i][j].val -= min_val;
         }
+        lowerBound_ += static_cast<Accumulator>(jobs[j].discr) * min_val;
     }
 
-    for (size_t i = 0; i < agents.size(); ++i)
+    switch (initialFlow_)
     {
-        for (size_t j = 0; j < jobs.size(); ++j)
+    case InitialFlow::Sequential:
+        buildSequentialFlow(workspace);
+        break;
+    case InitialFlow::Greedy:
+        buildGreedyFlow(workspace);
+        break;
+    case InitialFlow::Vogel:
+        buildVogelFlow(workspace);
+        break;
+    case InitialFlow::Russell:
+        buildRussellFlow(workspace);
+        break;
+    }
+}
+
+template <typename Cost>
+void BasicTransportationProblem<Cost>::assignQuota(size_t i, size_t j, Workspace &workspace)
+{
+    auto &agents = workspace.agents_;
+    auto &jobs = workspace.jobs_;
+    int min_quota = std::min(agents[i].discr, jobs[j].discr);
+    workspace.matrix_[i][j].quota += min_quota;
+    agents[i].discr -= min_quota;
+    jobs[j].discr -= min_quota;
+}
+
+template <typename Cost>
+void BasicTransportationProblem<Cost>::collectAdmissibleCells(Workspace &workspace)
+{
+    auto admissible = [&workspace](size_t i, size_t j)
+    {
+        return workspace.matrix_[i][j].val == 0 && workspace.agents_[i].discr > 0 && workspace.jobs_[j].discr > 0;
+    };
+
+    // Se cuentan primero: la lista solo pide las celdas de costo reducido cero
+    size_t count = 0;
+    for (size_t i = 0; i < workspace.agents_.size(); ++i)
+    {
+        for (size_t j = 0; j < workspace.jobs_.size(); ++j)
+        {
+            count += admissible(i, j) ? 1 : 0;
+        }
+    }
+    workspace.cells_.clear();
+    workspace.cells_.reserve(count);
+    for (size_t i = 0; i < workspace.agents_.size(); ++i)
+    {
+        for (size_t j = 0; j < workspace.jobs_.size(); ++j)
         {
-            if (matrix[i][j].val == 0 && agents[i].discr > 0 && jobs[j].discr > 0)
+            if (admissible(i, j))
             {
-                int min_quota = std::min(agents[i].discr, jobs[j].discr);
-                matrix[i][j].quota += min_quota;
-                agents[i].discr -= min_quota;
-                jobs[j].discr -= min_quota;
+                workspace.cells_.emplace_back(i, j);
             }
         }
     }
 }
 
-bool TransportationProblem::isProblemSolved(const std::vector<AgentJobEntry> &agents,
-                                            const std::vector<AgentJobEntry> &jobs) const
+template <typename Cost>
+void BasicTransportationProblem<Cost>::buildSequentialFlow(Workspace &workspace)
 {
-    for (const auto &agent : agents)
+    for (size_t i = 0; i < workspace.agents_.size(); ++i)
+    {
+        for (size_t j = 0; j < workspace.jobs_.size(); ++j)
+        {
+            if (workspace.matrix_[i][j].val == 0 && workspace.agents_[i].discr > 0 && workspace.jobs_[j].discr > 0)
+            {
+                assignQuota(i, j, workspace);
+            }
+        }
+    }
+}
+
+template <typename Cost>
+void BasicTransportationProblem<Cost>::buildGreedyFlow(Workspace &workspace)
+{
+    collectAdmissibleCells(workspace);
+    const auto &matrix = workspace.matrix_;
+    std::sort(workspace.cells_.begin(), workspace.cells_.end(),
+              [&matrix](const std::pair<size_t, size_t> &a, const std::pair<size_t, size_t> &b)
+              {
+                  Cost costA = matrix[a.first][a.second].init_cost;
+                  Cost costB = matrix[b.first][b.second].init_cost;
+                  return costA != costB ? costA < costB : a < b;
+              });
+
+    for (const auto &[i, j] : workspace.cells_)
+    {
+        if (workspace.agents_[i].discr > 0 && workspace.jobs_[j].discr > 0)
+        {
+            assignQuota(i, j, workspace);
+        }
+    }
+}
+
+template <typename Cost>
+void BasicTransportationProblem<Cost>::buildVogelFlow(Workspace &workspace)
+{
+    collectAdmissibleCells(workspace);
+    const auto &agents = workspace.agents_;
+    const auto &jobs = workspace.jobs_;
+    const auto &cells = workspace.cells_;
+    size_t m = agents.size();
+    size_t lines = m + jobs.size();
+    const size_t none = std::numeric_limits<size_t>::max();
+    const Cost infinity = std::numeric_limits<Cost>::max();
+
+    // Cada asignación agota una fila o una columna: a lo sumo m + n iteraciones
+    while (true)
+    {
+        // Los dos costos más baratos de cada línea entre sus celdas activas
+        workspace.lineFirst_.assign(lines, infinity);
+        workspace.lineSecond_.assign(lines, infinity);
+        workspace.lineCell_.assign(lines, none);
+        for (size_t c = 0; c < cells.size(); ++c)
+        {
+            auto [i, j] = cells[c];
+            if (agents[i].discr == 0 || jobs[j].discr == 0)
+            {
+                continue;
+            }
+            Cost cost = workspace.matrix_[i][j].init_cost;
+            for (size_t line : {i, m + j})
+            {
+                if (cost < workspace.lineFirst_[line])
+                {
+                    workspace.lineSecond_[line] = workspace.lineFirst_[line];
+                    workspace.lineFirst_[line] = cost;
+                    workspace.lineCell_[line] = c;
+                }
+                else if (cost < workspace.lineSecond_[line])
+                {
+                    workspace.lineSecond_[line] = cost;
+                }
+            }
+        }
+
+        // La línea con mayor penalización; una sola celda es una penalización infinita
+        size_t bestLine = none;
+        bool bestForced = false;
+        Cost bestPenalty = 0;
+        for (size_t line = 0; line < lines; ++line)
+        {
+            if (workspace.lineCell_[line] == none)
+            {
+                continue;
+            }
+            bool forced = workspace.lineSecond_[line] == infinity;
+            Cost penalty = forced ? 0 : workspace.lineSecond_[line] - workspace.lineFirst_[line];
+            if (bestLine == none || (forced && !bestForced) || (forced == bestForced && penalty > bestPenalty))
+            {
+                bestLine = line;
+                bestForced = forced;
+                bestPenalty = penalty;
+            }
+        }
+        if (bestLine == none)
+        {
+            return;
+        }
+
+        auto [i, j] = cells[workspace.lineCell_[bestLine]];
+        assignQuota(i, j, workspace);
+    }
+}
+
+template <typename Cost>
+void BasicTransportationProblem<Cost>::buildRussellFlow(Workspace &workspace)
+{
+    collectAdmissibleCells(workspace);
+    const auto &agents = workspace.agents_;
+    const auto &jobs = workspace.jobs_;
+    const auto &cells = workspace.cells_;
+    size_t m = agents.size();
+    const size_t none = std::numeric_limits<size_t>::max();
+
+    while (true)
+    {
+        // u_i y v_j: el costo más caro de cada línea entre sus celdas activas
+        workspace.lineFirst_.assign(m + jobs.size(), std::numeric_limits<Cost>::lowest());
+        for (const auto &[i, j] : cells)
+        {
+            if (agents[i].discr > 0 && jobs[j].discr > 0)
+            {
+                Cost cost = workspace.matrix_[i][j].init_cost;
+                workspace.lineFirst_[i] = std::max(workspace.lineFirst_[i], cost);
+                workspace.lineFirst_[m + j] = std::max(workspace.lineFirst_[m + j], cost);
+            }
+        }
+
+        size_t bestCell = none;
+        Accumulator bestDelta = 0;
+        for (size_t c = 0; c < cells.size(); ++c)
+        {
+            auto [i, j] = cells[c];
+            if (agents[i].discr == 0 || jobs[j].discr == 0)
+            {
+                continue;
+            }
+            Accumulator delta = static_cast<Accumulator>(workspace.matrix_[i][j].init_cost) -
+                                workspace.lineFirst_[i] - workspace.lineFirst_[m + j];
+            if (bestCell == none || delta < bestDelta)
+            {
+                bestCell = c;
+                bestDelta = delta;
+            }
+        }
+        if (bestCell == none)
+        {
+            return;
+        }
+
+        auto [i, j] = cells[bestCell];
+        assignQuota(i, j, workspace);
+    }
+}
+
+template <typename Cost>
+bool BasicTransportationProblem<Cost>::isProblemSolved(const Workspace &workspace) const
+{
+    for (const auto &agent : workspace.agents_)
     {
         if (agent.discr > 0)
             return false;
     }
-    for (const auto &job : jobs)
+    for (const auto &job : workspace.jobs_)
     {
         if (job.discr > 0)
             return false;
@@ -154,10 +494,14 @@ bool TransportationProblem::isProblemSolved(const std::vector<AgentJobEntry> &ag
     return true;
 }
 
-void TransportationProblem::executeStep1(std::vector<AgentJobEntry> &agents,
-                                         std::vector<AgentJobEntry> &jobs,
-                                         std::vector<std::vector<MatrixEntry>> &matrix)
+template <typename Cost>
+void BasicTransportationProblem<Cost>::executeStep1(Workspace &workspace)
 {
+    CFLP_COUNT(HungarianStep1);
+    auto &agents = workspace.agents_;
+    auto &jobs = workspace.jobs_;
+    auto &matrix = workspace.matrix_;
+
     bool something_changed = true;
     while (something_changed)
     {
@@ -173,31 +517,32 @@ void TransportationProblem::executeStep1(std::vector<AgentJobEntry> &agents,
 
                     if (agents[i].discr > 0)
                     {
-                        executeStep2(i, j, agents, jobs, matrix);
+                        executeStep2(i, j, workspace);
                         return;
                     }
                     else
                     {
-                        markAgentAndStarJob(i, agents, jobs, matrix);
+                        markAgentAndStarJob(i, workspace);
                     }
                 }
             }
         }
     }
-    executeStep3(agents, jobs, matrix);
+    executeStep3(workspace);
 }
 
-void TransportationProblem::executeStep2(size_t i0, size_t j0,
-                                         std::vector<AgentJobEntry> &agents,
-                                         std::vector<AgentJobEntry> &jobs,
-                                         std::vector<std::vector<MatrixEntry>> &matrix)
+template <typename Cost>
+void BasicTransportationProblem<Cost>::executeStep2(size_t i0, size_t j0, Workspace &workspace)
 {
+    CFLP_COUNT(HungarianStep2);
+    auto &agents = workspace.agents_;
+    auto &jobs = workspace.jobs_;
+    auto &matrix = workspace.matrix_;
+    auto &primed_seen = workspace.primedSeen_;
+    auto &starred_seen = workspace.starredSeen_;
+
     size_t current_j = j0;
     int min_quota = agents[i0].discr;
-
-    size_t max_dim = std::max(jobs.size(), agents.size());
-    std::vector<MatrixEntry *> primed_seen(max_dim, nullptr);
-    std::vector<MatrixEntry *> starred_seen(max_dim, nullptr);
     size_t idx = 0;
 
     bool seen_star = true;
@@ -239,20 +584,41 @@ void TransportationProblem::executeStep2(size_t i0, size_t j0,
         starred_seen[idx]->quota -= min_quota;
     }
 
-    resetMarks(agents, jobs, matrix);
+    resetMarks(workspace);
 }
 
-void TransportationProblem::executeStep3(std::vector<AgentJobEntry> &agents,
-                                         std::vector<AgentJobEntry> &jobs,
-                                         std::vector<std::vector<MatrixEntry>> &matrix)
+template <typename Cost>
+void BasicTransportationProblem<Cost>::executeStep3(Workspace &workspace)
 {
-    int h = findMinimumUnmarkedValue(agents, jobs, matrix);
+    CFLP_COUNT(HungarianStep3);
+    auto &agents = workspace.agents_;
+    auto &jobs = workspace.jobs_;
+    auto &matrix = workspace.matrix_;
+    Cost h = findMinimumUnmarkedValue(workspace);
 
     if (h <= 0)
     {
         throw std::runtime_error("Error en el paso 3: h no es positivo");
     }
 
+    // u_i baja h en los agentes marcados y v_j sube h en los trabajos sin marcar
+    Accumulator gain = 0;
+    for (size_t i = 0; i < agents.size(); ++i)
+    {
+        if (agents[i].marked)
+        {
+            gain -= supply_[i];
+        }
+    }
+    for (size_t j = 0; j < jobs.size(); ++j)
+    {
+        if (!jobs[j].marked)
+        {
+            gain += demand_[j];
+        }
+    }
+    lowerBound_ += gain * h;
+
     for (size_t i = 0; i < agents.size(); ++i)
     {
         for (size_t j = 0; j < jobs.size(); ++j)
@@ -269,11 +635,13 @@ void TransportationProblem::executeStep3(std::vector<AgentJobEntry> &agents,
     }
 }
 
-void TransportationProblem::markAgentAndStarJob(size_t i,
-                                                std::vector<AgentJobEntry> &agents,
-                                                std::vector<AgentJobEntry> &jobs,
-                                                std::vector<std::vector<MatrixEntry>> &matrix)
+template <typename Cost>
+void BasicTransportationProblem<Cost>::markAgentAndStarJob(size_t i, Workspace &workspace)
 {
+    auto &agents = workspace.agents_;
+    auto &jobs = workspace.jobs_;
+    auto &matrix = workspace.matrix_;
+
     agents[i].marked = true;
     for (size_t k = 0; k < jobs.size(); ++k)
     {
@@ -285,10 +653,13 @@ void TransportationProblem::markAgentAndStarJob(size_t i,
     }
 }
 
-void TransportationProblem::resetMarks(std::vector<AgentJobEntry> &agents,
-                                       std::vector<AgentJobEntry> &jobs,
-                                       std::vector<std::vector<MatrixEntry>> &matrix)
+template <typename Cost>
+void BasicTransportationProblem<Cost>::resetMarks(Workspace &workspace)
 {
+    auto &agents = workspace.agents_;
+    auto &jobs = workspace.jobs_;
+    auto &matrix = workspace.matrix_;
+
     for (size_t i = 0; i < agents.size(); ++i)
     {
         for (size_t j = 0; j < jobs.size(); ++j)
@@ -308,11 +679,14 @@ void TransportationProblem::resetMarks(std::vector<AgentJobEntry> &agents,
     }
 }
 
-int TransportationProblem::findMinimumUnmarkedValue(const std::vector<AgentJobEntry> &agents,
-                                                    const std::vector<AgentJobEntry> &jobs,
-                                                    const std::vector<std::vector<MatrixEntry>> &matrix) const
+template <typename Cost>
+Cost BasicTransportationProblem<Cost>::findMinimumUnmarkedValue(const Workspace &workspace) const
 {
-    int h = std::numeric_limits<int>::max();
+    const auto &agents = workspace.agents_;
+    const auto &jobs = workspace.jobs_;
+    const auto &matrix = workspace.matrix_;
+
+    Cost h = std::numeric_limits<Cost>::max();
     for (size_t i = 0; i < agents.size(); ++i)
     {
         for (size_t j = 0; j < jobs.size(); ++j)
@@ -326,45 +700,53 @@ int TransportationProblem::findMinimumUnmarkedValue(const std::vector<AgentJobEn
     return h;
 }
 
-void TransportationProblem::finalizeSolution(const std::vector<std::vector<MatrixEntry>> &matrix)
+template <typename Cost>
+void BasicTransportationProblem<Cost>::finalizeSolution(const Workspace &workspace)
 {
     totalCost_ = 0;
-    for (size_t i = 0; i < matrix.size(); ++i)
+    for (size_t i = 0; i < workspace.agents_.size(); ++i)
     {
-        for (size_t j = 0; j < matrix[i].size(); ++j)
+        for (size_t j = 0; j < workspace.jobs_.size(); ++j)
         {
-            assignmentMatrix_[i][j] = matrix[i][j].quota;
-            totalCost_ += matrix[i][j].quota * matrix[i][j].init_cost;
+            const MatrixEntry &entry = workspace.matrix_[i][j];
+            assignmentMatrix_[i][j] = entry.quota;
+            totalCost_ += static_cast<Accumulator>(entry.quota) * entry.init_cost;
         }
     }
 }
 
-int TransportationProblem::getTotalCost() const
+template <typename Cost>
+typename BasicTransportationProblem<Cost>::Accumulator BasicTransportationProblem<Cost>::getTotalCost() const
 {
     return totalCost_;
 }
 
-const std::vector<std::vector<int>> &TransportationProblem::getAssignmentMatrix() const
+template <typename Cost>
+const std::vector<std::vector<int>> &BasicTransportationProblem<Cost>::getAssignmentMatrix() const
 {
     return assignmentMatrix_;
 }
 
-const std::vector<std::vector<int>> &TransportationProblem::getCostMatrix() const
+template <typename Cost>
+const typename BasicTransportationProblem<Cost>::CostMatrix &BasicTransportationProblem<Cost>::getCostMatrix() const
 {
     return costMatrix_;
 }
 
-const std::vector<int> &TransportationProblem::getSupply() const
+template <typename Cost>
+const std::vector<int> &BasicTransportationProblem<Cost>::getSupply() const
 {
     return supply_;
 }
 
-const std::vector<int> &TransportationProblem::getDemand() const
+template <typename Cost>
+const std::vector<int> &BasicTransportationProblem<Cost>::getDemand() const
 {
     return demand_;
 }
 
-void TransportationProblem::setCostMatrix(const std::vector<std::vector<int>> &newCostMatrix)
+template <typename Cost>
+void BasicTransportationProblem<Cost>::setCostMatrix(const CostMatrix &newCostMatrix)
 {
     if (newCostMatrix.size() != supply_.size())
         throw std::invalid_argument("New cost matrix row count must match supply size.");
@@ -377,7 +759,8 @@ void TransportationProblem::setCostMatrix(const std::vector<std::vector<int>> &n
     initializeAssignment();
 }
 
-void TransportationProblem::setSupply(const std::vector<int> &newSupply)
+template <typename Cost>
+void BasicTransportationProblem<Cost>::setSupply(const std::vector<int> &newSupply)
 {
     if (newSupply.size() != costMatrix_.size())
         throw std::invalid_argument("New supply size must match cost matrix rows.");
@@ -385,7 +768,8 @@ void TransportationProblem::setSupply(const std::vector<int> &newSupply)
     initializeAssignment();
 }
 
-void TransportationProblem::setDemand(const std::vector<int> &newDemand)
+template <typename Cost>
+void BasicTransportationProblem<Cost>::setDemand(const std::vector<int> &newDemand)
 {
     if (!costMatrix_.empty() && newDemand.size() != costMatrix_[0].size())
         throw std::invalid_argument("New demand size must match cost matrix columns.");
@@ -393,27 +777,32 @@ void TransportationProblem::setDemand(const std::vector<int> &newDemand)
     initializeAssignment();
 }
 
-void TransportationProblem::setTotalSupply(int newTotalSupply)
+template <typename Cost>
+void BasicTransportationProblem<Cost>::setTotalSupply(int newTotalSupply)
 {
     totalSupply_ = newTotalSupply;
 }
 
-int TransportationProblem::getTotalSupply() const
+template <typename Cost>
+int BasicTransportationProblem<Cost>::getTotalSupply() const
 {
     return totalSupply_;
 }
 
-void TransportationProblem::setTotalDemand(int newTotalDemand)
+template <typename Cost>
+void BasicTransportationProblem<Cost>::setTotalDemand(int newTotalDemand)
 {
     totalDemand_ = newTotalDemand;
 }
 
-int TransportationProblem::getTotalDemand() const
+template <typename Cost>
+int BasicTransportationProblem<Cost>::getTotalDemand() const
 {
     return totalDemand_;
 }
 
-void TransportationProblem::balance()
+template <typename Cost>
+void BasicTransportationProblem<Cost>::balance()
 {
     if (totalSupply_ == totalDemand_)
     {
@@ -431,7 +820,7 @@ void TransportationProblem::balance()
 
     for (auto &row : costMatrix_)
     {
-        row.push_back(0);
+        row.push_back(Cost(0));
     }
 
     for (auto &row : assignmentMatrix_)
@@ -442,8 +831,13 @@ void TransportationProblem::balance()
     totalDemand_ = totalSupply_;
 }
 
-void TransportationProblem::calculateTotalSupplyAndDemand()
+template <typename Cost>
+void BasicTransportationProblem<Cost>::calculateTotalSupplyAndDemand()
 {
     totalSupply_ = std::accumulate(supply_.begin(), supply_.end(), 0);
     totalDemand_ = std::accumulate(demand_.begin(), demand_.end(), 0);
-}
\ No newline at end of file
+}
+
+template class BasicTransportationProblem<int32_t>;
+template class BasicTransportationProblem<int64_t>;
+template class BasicTransportationProblem<double>;
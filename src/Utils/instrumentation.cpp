@@ -0,0 +1,200 @@
+#include "Utils/instrumentation.h"
+#include <algorithm>
+#include <iomanip>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Instrumentation
+{
+    namespace
+    {
+        const char *const kCounterNames[kCounterCount] = {
+            "hungarian_step1",
+            "hungarian_step2",
+            "hungarian_step3",
+            "transport_solves",
+            "transport_cutoffs",
+            "toggles",
+            "plqt_probes",
+            "plqt_probe_depth",
+            "plqt_inserts",
+            "plqt_insert_depth"};
+
+        const char *const kTimerNames[kTimerCount] = {
+            "transport_solve",
+            "main_search",
+            "altering",
+            "reconciling",
+            "path_relinking",
+            "diversification"};
+
+        /// Bloques vivos y totales de los hilos que ya terminaron
+        struct Registry
+        {
+            std::mutex mutex;
+            std::vector<detail::ThreadBlock *> blocks;
+            Report retired;
+        };
+
+        Registry &registry()
+        {
+            // Nunca se destruye, para que los hilos que terminan tarde aún puedan retirarse
+            static Registry *instance = new Registry();
+            return *instance;
+        }
+
+        Report read(const detail::ThreadBlock &block)
+        {
+            Report report;
+            for (size_t c = 0; c < kCounterCount; ++c)
+            {
+                report.counters[c] = block.counters[c].load(std::memory_order_relaxed);
+            }
+            for (size_t t = 0; t < kTimerCount; ++t)
+            {
+                report.nanoseconds[t] = block.nanoseconds[t].load(std::memory_order_relaxed);
+            }
+            return report;
+        }
+    }
+
+    const char *name(Counter counter)
+    {
+        return kCounterNames[static_cast<size_t>(counter)];
+    }
+
+    const char *name(Timer timer)
+    {
+        return kTimerNames[static_cast<size_t>(timer)];
+    }
+
+    Report &Report::operator+=(const Report &other)
+    {
+        for (size_t c = 0; c < kCounterCount; ++c)
+        {
+            counters[c] += other.counters[c];
+        }
+        for (size_t t = 0; t < kTimerCount; ++t)
+        {
+            nanoseconds[t] += other.nanoseconds[t];
+        }
+        return *this;
+    }
+
+    Report &Report::operator-=(const Report &other)
+    {
+        for (size_t c = 0; c < kCounterCount; ++c)
+        {
+            counters[c] -= std::min(counters[c], other.counters[c]);
+        }
+        for (size_t t = 0; t < kTimerCount; ++t)
+        {
+            nanoseconds[t] -= std::min(nanoseconds[t], other.nanoseconds[t]);
+        }
+        return *this;
+    }
+
+    void Report::writeJson(std::ostream &out, int indent) const
+    {
+        std::string pad(indent, ' ');
+        out << "{\n"
+            << pad << "  \"enabled\": " << (kEnabled ? "true" : "false") << ",\n"
+            << pad << "  \"counters\": {";
+        for (size_t c = 0; c < kCounterCount; ++c)
+        {
+            out << (c == 0 ? "\n" : ",\n") << pad << "    \"" << kCounterNames[c] << "\": " << counters[c];
+        }
+        out << "\n" << pad << "  },\n" << pad << "  \"seconds\": {";
+
+        std::ios_base::fmtflags flags = out.flags();
+        std::streamsize precision = out.precision();
+        out << std::fixed << std::setprecision(9);
+        for (size_t t = 0; t < kTimerCount; ++t)
+        {
+            out << (t == 0 ? "\n" : ",\n") << pad << "    \"" << kTimerNames[t] << "\": " << nanoseconds[t] * 1e-9;
+        }
+        out.flags(flags);
+        out.precision(precision);
+        out << "\n" << pad << "  }\n" << pad << "}";
+    }
+
+    Report threadReport()
+    {
+        if (!kEnabled)
+        {
+            return Report();
+        }
+        return read(detail::local());
+    }
+
+    Report collect()
+    {
+        Registry &state = registry();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        Report total = state.retired;
+        for (const detail::ThreadBlock *block : state.blocks)
+        {
+            total += read(*block);
+        }
+        return total;
+    }
+
+    void reset()
+    {
+        Registry &state = registry();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.retired = Report();
+        for (detail::ThreadBlock *block : state.blocks)
+        {
+            for (auto &value : block->counters)
+            {
+                value.store(0, std::memory_order_relaxed);
+            }
+            for (auto &value : block->nanoseconds)
+            {
+                value.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    namespace detail
+    {
+        ThreadBlock::ThreadBlock()
+        {
+            Registry &state = registry();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.blocks.push_back(this);
+        }
+
+        ThreadBlock::~ThreadBlock()
+        {
+            Registry &state = registry();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.retired += read(*this);
+            state.blocks.erase(std::remove(state.blocks.begin(), state.blocks.end(), this), state.blocks.end());
+        }
+    }
+
+    ScopedPhase::ScopedPhase(Timer phase)
+    {
+        detail::ThreadBlock &block = detail::local();
+        detail::Clock::time_point now = detail::Clock::now();
+        if (block.phase >= 0)
+        {
+            detail::bump(block.nanoseconds[block.phase], detail::elapsed(block.phaseStart, now));
+        }
+        previous_ = block.phase;
+        block.phase = static_cast<int>(phase);
+        block.phaseStart = now;
+    }
+
+    ScopedPhase::~ScopedPhase()
+    {
+        detail::ThreadBlock &block = detail::local();
+        detail::Clock::time_point now = detail::Clock::now();
+        detail::bump(block.nanoseconds[block.phase], detail::elapsed(block.phaseStart, now));
+        block.phase = previous_;
+        block.phaseStart = now;
+    }
+}
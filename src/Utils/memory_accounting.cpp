@@ -0,0 +1,220 @@
+#include "Utils/memory_accounting.h"
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+namespace MemoryAccounting
+{
+    namespace
+    {
+        const char *const kSubsystemNames[kSubsystemCount] = {
+            "other",
+            "problem",
+            "transport",
+            "plqt",
+            "solver"};
+
+        /// Contadores de un hilo; inicialización constante, así que usarlos dentro de operator new es seguro
+        struct ThreadState
+        {
+            Usage usage[kSubsystemCount];
+            int64_t currentBytes = 0;
+            int64_t peakBytes = 0;
+            Subsystem scope = Subsystem::Other;
+        };
+
+        thread_local ThreadState state;
+
+#ifdef CFLP_ALLOCATION_TRACKING
+        /// Cabecera delante de cada bloque; 16 bytes para conservar la alineación de malloc
+        struct alignas(16) BlockHeader
+        {
+            uint64_t size;
+            uint32_t subsystem;
+        };
+
+        void *trackedAllocate(std::size_t size) noexcept
+        {
+            void *raw = std::malloc(size + sizeof(BlockHeader));
+            if (raw == nullptr)
+            {
+                return nullptr;
+            }
+            ThreadState &thread = state;
+            BlockHeader *header = static_cast<BlockHeader *>(raw);
+            header->size = size;
+            header->subsystem = static_cast<uint32_t>(thread.scope);
+
+            Usage &usage = thread.usage[header->subsystem];
+            usage.allocations++;
+            usage.totalBytes += size;
+            usage.currentBytes += static_cast<int64_t>(size);
+            usage.peakBytes = std::max(usage.peakBytes, usage.currentBytes);
+            thread.currentBytes += static_cast<int64_t>(size);
+            thread.peakBytes = std::max(thread.peakBytes, thread.currentBytes);
+            return header + 1;
+        }
+
+        void *trackedAllocateOrThrow(std::size_t size)
+        {
+            void *ptr = trackedAllocate(size);
+            if (ptr == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            return ptr;
+        }
+
+        void trackedFree(void *ptr) noexcept
+        {
+            if (ptr == nullptr)
+            {
+                return;
+            }
+            BlockHeader *header = static_cast<BlockHeader *>(ptr) - 1;
+            ThreadState &thread = state;
+            thread.usage[header->subsystem].currentBytes -= static_cast<int64_t>(header->size);
+            thread.currentBytes -= static_cast<int64_t>(header->size);
+            std::free(header);
+        }
+#endif
+    }
+
+    const char *name(Subsystem subsystem)
+    {
+        return kSubsystemNames[static_cast<size_t>(subsystem)];
+    }
+
+    Usage Report::total() const
+    {
+        Usage sum;
+        for (const Usage &part : usage)
+        {
+            sum.allocations += part.allocations;
+            sum.totalBytes += part.totalBytes;
+            sum.currentBytes += part.currentBytes;
+        }
+        sum.peakBytes = peakTotalBytes;
+        return sum;
+    }
+
+    void Report::writeJson(std::ostream &out, int indent) const
+    {
+        std::string pad(indent, ' ');
+        out << "{\n"
+            << pad << "  \"enabled\": " << (kEnabled ? "true" : "false") << ",\n"
+            << pad << "  \"peak_total_bytes\": " << peakTotalBytes << ",\n"
+            << pad << "  \"subsystems\": {";
+        for (size_t s = 0; s < kSubsystemCount; ++s)
+        {
+            out << (s == 0 ? "\n" : ",\n") << pad << "    \"" << kSubsystemNames[s] << "\": {\"allocations\": "
+                << usage[s].allocations << ", \"total_bytes\": " << usage[s].totalBytes
+                << ", \"current_bytes\": " << usage[s].currentBytes << ", \"peak_bytes\": " << usage[s].peakBytes
+                << "}";
+        }
+        out << "\n" << pad << "  }\n" << pad << "}";
+    }
+
+    Report threadUsage()
+    {
+        Report report;
+        const ThreadState &thread = state;
+        std::copy(std::begin(thread.usage), std::end(thread.usage), report.usage.begin());
+        report.peakTotalBytes = thread.peakBytes;
+        return report;
+    }
+
+    ThreadMeter::ThreadMeter() : start_(threadUsage())
+    {
+        // Los picos previos no cuentan: desde aquí se mide el crecimiento
+        ThreadState &thread = state;
+        for (Usage &usage : thread.usage)
+        {
+            usage.peakBytes = usage.currentBytes;
+        }
+        thread.peakBytes = thread.currentBytes;
+    }
+
+    Report ThreadMeter::read() const
+    {
+        Report now = threadUsage();
+        Report report;
+        int64_t startTotal = 0;
+        for (size_t s = 0; s < kSubsystemCount; ++s)
+        {
+            const Usage &before = start_.usage[s];
+            const Usage &after = now.usage[s];
+            Usage &usage = report.usage[s];
+            usage.allocations = after.allocations - before.allocations;
+            usage.totalBytes = after.totalBytes - before.totalBytes;
+            usage.currentBytes = after.currentBytes - before.currentBytes;
+            usage.peakBytes = after.peakBytes - before.currentBytes;
+            startTotal += before.currentBytes;
+        }
+        report.peakTotalBytes = now.peakTotalBytes - startTotal;
+        return report;
+    }
+
+    Scope::Scope(Subsystem subsystem) : previous_(state.scope)
+    {
+        state.scope = subsystem;
+    }
+
+    Scope::~Scope()
+    {
+        state.scope = previous_;
+    }
+}
+
+#ifdef CFLP_ALLOCATION_TRACKING
+void *operator new(std::size_t size)
+{
+    return MemoryAccounting::trackedAllocateOrThrow(size);
+}
+
+void *operator new[](std::size_t size)
+{
+    return MemoryAccounting::trackedAllocateOrThrow(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    return MemoryAccounting::trackedAllocate(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    return MemoryAccounting::trackedAllocate(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    MemoryAccounting::trackedFree(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    MemoryAccounting::trackedFree(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    MemoryAccounting::trackedFree(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+    MemoryAccounting::trackedFree(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+    MemoryAccounting::trackedFree(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept
+{
+    MemoryAccounting::trackedFree(ptr);
+}
+#endif
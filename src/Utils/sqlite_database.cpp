@@ -0,0 +1,76 @@
+#include "Utils/sqlite_database.h"
+#include <sqlite3.h>
+#include <stdexcept>
+
+SqliteStatement::SqliteStatement(sqlite3 *database, sqlite3_stmt *statement)
+    : database_(database), statement_(statement, &sqlite3_finalize)
+{
+}
+
+void SqliteStatement::bind(int parameter, int64_t value)
+{
+    sqlite3_bind_int64(statement_.get(), parameter, value);
+}
+
+void SqliteStatement::bind(int parameter, const std::string &value)
+{
+    sqlite3_bind_text(statement_.get(), parameter, value.c_str(), -1, SQLITE_TRANSIENT);
+}
+
+bool SqliteStatement::step()
+{
+    int status = sqlite3_step(statement_.get());
+    if (status == SQLITE_ROW)
+    {
+        return true;
+    }
+    if (status != SQLITE_DONE)
+    {
+        throw std::runtime_error("SQLite query failed: " + std::string(sqlite3_errmsg(database_)));
+    }
+    return false;
+}
+
+int64_t SqliteStatement::columnInt64(int column) const
+{
+    return sqlite3_column_int64(statement_.get(), column);
+}
+
+double SqliteStatement::columnDouble(int column) const
+{
+    return sqlite3_column_double(statement_.get(), column);
+}
+
+std::string SqliteStatement::columnText(int column) const
+{
+    const unsigned char *text = sqlite3_column_text(statement_.get(), column);
+    return text != nullptr ? reinterpret_cast<const char *>(text) : "";
+}
+
+SqliteDatabase::SqliteDatabase(const std::string &path)
+    : path_(path), database_(nullptr, &sqlite3_close)
+{
+    sqlite3 *handle = nullptr;
+    int status = sqlite3_open_v2(path.c_str(), &handle, SQLITE_OPEN_READONLY, nullptr);
+    database_.reset(handle);
+    if (status != SQLITE_OK)
+    {
+        std::string message = handle != nullptr ? sqlite3_errmsg(handle) : "out of memory";
+        throw std::runtime_error("Unable to open database " + path + ": " + message);
+    }
+}
+
+SqliteStatement SqliteDatabase::prepare(const std::string &sql) const
+{
+    sqlite3_stmt *statement = nullptr;
+    if (sqlite3_prepare_v2(database_.get(), sql.c_str(), -1, &statement, nullptr) != SQLITE_OK)
+    {
+        throw std::runtime_error("Unable to query " + path_ + ": " + sqlite3_errmsg(database_.get()));
+    }
+    return SqliteStatement(database_.get(), statement);
+}
+
+const std::string &SqliteDatabase::path() const
+{
+    return path_;
+}
@@ -1,10 +1,161 @@
-#include "TransportProblem/transport_problem.h"
-#include "Reader/beasley_instance_reader.h"
+#include "Experiments/batch_runner.h"
+#include "Experiments/solve_service.h"
 
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
+#include <string>
 
-int main()
+namespace
 {
-    BeasleyInstanceReader reader;
-    CFLPProblem problem = reader.readInstance("instances/Beasley/cap41.txt");
+    template <typename T>
+    std::vector<T> parseList(const std::string &value)
+    {
+        std::vector<T> items;
+        std::istringstream list(value);
+        std::string item;
+        while (std::getline(list, item, ','))
+        {
+            std::istringstream parser(item);
+            T parsed;
+            if (!(parser >> parsed) || !parser.eof())
+            {
+                throw std::invalid_argument("Invalid list value: " + item);
+            }
+            items.push_back(parsed);
+        }
+        return items;
+    }
+
+    void writeFile(const std::string &path, void (*write)(const std::vector<BatchRunResult> &, std::ostream &),
+                   const std::vector<BatchRunResult> &results)
+    {
+        std::ofstream out(path);
+        if (!out.is_open())
+        {
+            throw std::runtime_error("Unable to write " + path);
+        }
+        write(results, out);
+    }
+}
+
+/**
+ * Runs the tabu search over a batch of instances and reports the results.
+ *
+ * Usage: CapacitatedFacilityLocationProblem [options] <instance | directory | pattern>...
+ *   --seeds A,B,...        seeds of the tabu search (default 1)
+ *   --time-limits S,T,...  time limits in seconds, 0 for none (default 0)
+ *   --threads N            concurrent solves (0 for all cores)
+ *   --csv FILE             write the results as CSV
+ *   --json FILE            write the results as JSON
+ *   --trace DIR            write the moves of every run as CSV files in DIR
+ *   --cost-scale S         scale of the integer costs (default 1000)
+ *   --unit-costs           the files already give costs per unit of demand
+ *   --serve SOCKET         run as a daemon on a Unix domain socket ("-" for stdin/stdout)
+ *
+ * Every instance is solved once per seed and time limit. A summary with the
+ * gap to the published OR-Library optimum is printed to standard output.
+ * Without arguments, instances/Beasley is solved.
+ *
+ * With --serve, the process keeps instances in memory and answers
+ * length-prefixed solve requests with --threads workers instead (see
+ * SolveService); the other options are ignored.
+ */
+int main(int argc, char *argv[])
+{
+    BatchRunOptions options;
+    std::string csvPath;
+    std::string jsonPath;
+    std::string servePath;
+    try
+    {
+        for (int arg = 1; arg < argc; ++arg)
+        {
+            std::string flag = argv[arg];
+            if (flag.rfind("--", 0) != 0)
+            {
+                options.instances.push_back(flag);
+                continue;
+            }
+            if (flag == "--unit-costs")
+            {
+                options.allocationCosts = false;
+                continue;
+            }
+            if (arg + 1 >= argc)
+            {
+                throw std::invalid_argument("Missing value for " + flag);
+            }
+            std::string value = argv[++arg];
+
+            if (flag == "--seeds")
+                options.seeds = parseList<unsigned>(value);
+            else if (flag == "--time-limits")
+                options.timeLimits = parseList<double>(value);
+            else if (flag == "--threads")
+                options.threads = static_cast<unsigned>(std::stoul(value));
+            else if (flag == "--csv")
+                csvPath = value;
+            else if (flag == "--json")
+                jsonPath = value;
+            else if (flag == "--trace")
+                options.traceDirectory = value;
+            else if (flag == "--serve")
+                servePath = value;
+            else if (flag == "--cost-scale")
+                options.costScale = std::stod(value);
+            else
+                throw std::invalid_argument("Unknown option " + flag);
+        }
+        if (!servePath.empty())
+        {
+            SolveService service(options.threads);
+            if (servePath == "-")
+                service.serveStream(0, 1);
+            else
+                service.serveSocket(servePath);
+            return 0;
+        }
+        if (options.instances.empty())
+        {
+            options.instances.push_back("instances/Beasley");
+        }
+
+        std::vector<BatchRunResult> results = BatchRunner(options).run();
+        if (!csvPath.empty())
+        {
+            writeFile(csvPath, BatchRunner::writeCsv, results);
+        }
+        if (!jsonPath.empty())
+        {
+            writeFile(jsonPath, BatchRunner::writeJson, results);
+        }
+
+        int failures = 0;
+        std::cout << std::fixed << std::setprecision(3);
+        for (const BatchRunResult &result : results)
+        {
+            std::cout << result.instance << " seed=" << result.seed << " limit=" << result.timeLimit << "s: ";
+            if (!result.error.empty())
+            {
+                std::cout << "error: " << result.error << std::endl;
+                ++failures;
+                continue;
+            }
+            std::cout << result.objective;
+            if (result.gap)
+            {
+                std::cout << " (gap " << *result.gap << "%)";
+            }
+            std::cout << " best at " << result.timeToBest << "s of " << result.totalTime << "s, "
+                      << result.iterations << " moves" << std::endl;
+        }
+        return failures == 0 ? 0 : 1;
+    }
+    catch (const std::exception &error)
+    {
+        std::cerr << error.what() << std::endl;
+        return 2;
+    }
 }
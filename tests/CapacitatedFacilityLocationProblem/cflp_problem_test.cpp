@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include "CapacitatedFacilityLocationProblem/cflp_problem.h"
+#include "PLQT/plqt.h"
+
+namespace {
+
+CFLPProblem makeProblem() {
+    std::vector<std::vector<int>> costMatrix = {
+        {4, 8, 6, 9},
+        {7, 3, 5, 4},
+        {6, 7, 2, 8}};
+    std::vector<int> capacities = {20, 25, 15};
+    std::vector<int> demands = {8, 6, 9, 7};
+    std::vector<double> openingCosts = {30, 40, 20};
+    return CFLPProblem(costMatrix, capacities, demands, openingCosts);
+}
+
+} // namespace
+
+TEST(CFLPProblemTest, InitializeSubproblemComputesCost) {
+    CFLPProblem problem = makeProblem();
+    problem.initializeSubproblem({1, 1, 0});
+
+    EXPECT_EQ(problem.getBestSolution(), (std::vector<int>{1, 1, 0}));
+    EXPECT_EQ(problem.getCostOfFacilities(), 70);
+    EXPECT_EQ(problem.getCurrentCost(),
+              problem.getCostOfFacilities() + problem.getCostOfTransportation());
+    EXPECT_EQ(problem.getCurrentTotalSupply(), 45);
+}
+
+TEST(CFLPProblemTest, ToggleUsesCachedCostWithoutSolving) {
+    CFLPProblem reference = makeProblem();
+    reference.initializeSubproblem({1, 1, 0});
+    reference.toggleFacility(2);
+    int openedCost = reference.getCurrentCost();
+
+    CFLPProblem problem = makeProblem();
+    problem.initializeSubproblem({1, 1, 0});
+    int initialCost = problem.getCurrentCost();
+
+    PLQT cache(3, new PLQTNode({1, 1, 0}));
+    cache.getRoot()->setCost(initialCost);
+    cache.insert({1, 1, 1})->setCost(openedCost);
+    problem.setSolutionCache(&cache);
+
+    problem.toggleFacility(2);
+    EXPECT_TRUE(problem.isTransportStale());
+    EXPECT_EQ(problem.getCurrentCost(), openedCost);
+    EXPECT_EQ(problem.getCurrentTotalSupply(), 60);
+
+    problem.toggleFacility(2);
+    EXPECT_TRUE(problem.isTransportStale());
+    EXPECT_EQ(problem.getCurrentCost(), initialCost);
+
+    // Accessing the subproblem solves it lazily for the current configuration
+    EXPECT_EQ(problem.getSubproblem().getTotalCost(), problem.getCostOfTransportation());
+    EXPECT_FALSE(problem.isTransportStale());
+}
+
+TEST(CFLPProblemTest, ToggleWithoutCachedCostSolves) {
+    CFLPProblem problem = makeProblem();
+    problem.initializeSubproblem({1, 1, 0});
+
+    PLQT cache(3, new PLQTNode({1, 1, 0}));
+    problem.setSolutionCache(&cache);
+
+    problem.toggleFacility(2);
+    EXPECT_FALSE(problem.isTransportStale());
+    EXPECT_EQ(problem.getCurrentCost(),
+              problem.getCostOfFacilities() + problem.getSubproblem().getTotalCost());
+}
+
+TEST(CFLPProblemTest, FixedPointKeepsFractionalCosts) {
+    std::vector<std::vector<double>> decimals = {
+        {4.125, 8.5, 6.0, 9.0},
+        {7.0, 3.25, 5.0, 4.75},
+        {6.0, 7.0, 2.5, 8.0}};
+    std::vector<std::vector<int64_t>> scaled(3, std::vector<int64_t>(4));
+    for (size_t i = 0; i < decimals.size(); ++i) {
+        for (size_t j = 0; j < decimals[i].size(); ++j) {
+            scaled[i][j] = CostTraits<int64_t>::fromDecimal(decimals[i][j]);
+        }
+    }
+    std::vector<int> capacities = {20, 25, 15};
+    std::vector<int> demands = {8, 6, 9, 7};
+    std::vector<double> openingCosts = {30.5, 40.25, 20.125};
+
+    BasicCFLPProblem<double> exact(decimals, capacities, demands, openingCosts);
+    BasicCFLPProblem<int64_t> fixed(scaled, capacities, demands, openingCosts);
+    exact.initializeSubproblem({1, 1, 1});
+    fixed.initializeSubproblem({1, 1, 1});
+
+    EXPECT_DOUBLE_EQ(exact.getCostOfFacilities(), 90.875);
+    EXPECT_EQ(fixed.getCostOfFacilities(), 9087500);
+    EXPECT_DOUBLE_EQ(CostTraits<int64_t>::toDouble(fixed.getCurrentCost()), exact.getCurrentCost());
+
+    exact.toggleFacility(2);
+    fixed.toggleFacility(2);
+    EXPECT_DOUBLE_EQ(CostTraits<int64_t>::toDouble(fixed.getCurrentCost()), exact.getCurrentCost());
+}
+
+TEST(CFLPProblemTest, ToggleWithCutoffStopsAtADominatedConfiguration) {
+    // Todos los clientes prefieren la instalación 0, que no alcanza a servirlos
+    auto makeCongested = [] {
+        return CFLPProblem({{1, 1, 1, 1}, {5, 6, 7, 8}, {9, 9, 9, 9}}, {10, 30, 30}, {8, 6, 9, 7}, {30, 40, 20});
+    };
+    CFLPProblem reference = makeCongested();
+    reference.initializeSubproblem({1, 1, 0});
+    reference.toggleFacility(2);
+    int64_t exact = reference.getCurrentCost();
+
+    CFLPProblem problem = makeCongested();
+    problem.initializeSubproblem({1, 1, 0});
+    EXPECT_TRUE(problem.toggleFacility(2, exact + 1));
+    EXPECT_EQ(problem.getCurrentCost(), exact);
+    problem.toggleFacility(2);
+
+    int64_t cutoff = problem.getCostOfFacilities() + 20 + 1;
+    EXPECT_FALSE(problem.toggleFacility(2, cutoff));
+    EXPECT_TRUE(problem.isTransportStale());
+    EXPECT_GE(problem.getCurrentCost(), cutoff);
+    EXPECT_LE(problem.getCurrentCost(), exact);
+
+    // El subproblema se resuelve completo al pedirlo
+    int64_t transport = problem.getSubproblem().getTotalCost();
+    EXPECT_EQ(problem.getCostOfFacilities() + transport, exact);
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include "CapacitatedFacilityLocationProblem/cflp_solution.h"
+#include "Reader/beasley_instance_reader.h"
+#include <fstream>
+
+namespace {
+
+std::string tempPath(const std::string &name) {
+    return ::testing::TempDir() + name;
+}
+
+} // namespace
+
+TEST(CFLPSolutionTest, RoundTripsOpenSetAndCost) {
+    CFLPSolution solution({0, 1, 1, 0, 1}, 7, 1234.125);
+    std::string path = tempPath("open.sol");
+    solution.write(path);
+
+    CFLPSolution loaded = CFLPSolution::read(path);
+    EXPECT_EQ(loaded.getOpenFacilities(), solution.getOpenFacilities());
+    EXPECT_EQ(loaded.getCustomerCount(), 7u);
+    EXPECT_DOUBLE_EQ(loaded.getCost(), 1234.125);
+    EXPECT_TRUE(loaded.getAssignments().empty());
+}
+
+TEST(CFLPSolutionTest, CapturesSparseAssignments) {
+    CFLPProblem problem = BeasleyInstanceReader().readInstance(std::string(CFLP_INSTANCES_DIR) + "/Beasley/cap41.txt");
+    // Cada instalación tiene capacidad 5000 y la demanda total es 58268
+    std::vector<int> open(16, 1);
+    for (int i : {2, 6, 13}) {
+        open[i] = 0;
+    }
+    CFLPSolution solution = CFLPSolution::evaluate(problem, open, true);
+    EXPECT_DOUBLE_EQ(solution.getCost(), static_cast<double>(problem.getCurrentCost()));
+
+    int shipped = 0;
+    for (const SolutionAssignment &assignment : solution.getAssignments()) {
+        EXPECT_EQ(open[assignment.facility], 1);
+        EXPECT_GT(assignment.amount, 0);
+        shipped += assignment.amount;
+    }
+    EXPECT_EQ(shipped, problem.getTotalDemand());
+
+    std::string path = tempPath("assigned.sol");
+    solution.write(path);
+    CFLPSolution loaded = CFLPSolution::read(path);
+    ASSERT_EQ(loaded.getAssignments().size(), solution.getAssignments().size());
+    for (size_t k = 0; k < loaded.getAssignments().size(); ++k) {
+        EXPECT_EQ(loaded.getAssignments()[k].facility, solution.getAssignments()[k].facility);
+        EXPECT_EQ(loaded.getAssignments()[k].customer, solution.getAssignments()[k].customer);
+        EXPECT_EQ(loaded.getAssignments()[k].amount, solution.getAssignments()[k].amount);
+    }
+}
+
+TEST(CFLPSolutionTest, RejectsMalformedFiles) {
+    EXPECT_THROW(CFLPSolution({0, 2}, 3, 0.0), std::invalid_argument);
+    EXPECT_THROW(CFLPSolution({0, 1}, 3, 0.0, {{1, 3, 5}}), std::invalid_argument);
+
+    std::string path = tempPath("bad.sol");
+    std::ofstream(path) << "CFLPSOL 1\n2 3\ncost 10\nopen 1\n4\n";
+    EXPECT_THROW(CFLPSolution::read(path), std::runtime_error);
+    std::ofstream(path) << "CFLPSOL 2\n2 3\ncost 10\nopen 0\n";
+    EXPECT_THROW(CFLPSolution::read(path), std::runtime_error);
+}
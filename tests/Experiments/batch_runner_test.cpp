@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "Experiments/batch_runner.h"
+#include "Experiments/known_optima.h"
+#include <sstream>
+
+namespace {
+
+std::string instancePath(const std::string &name) {
+    return std::string(CFLP_INSTANCES_DIR) + "/Beasley/" + name;
+}
+
+} // namespace
+
+TEST(KnownOptimaTest, LooksUpByNameOrPath) {
+    ASSERT_TRUE(knownOptimum("cap41").has_value());
+    EXPECT_DOUBLE_EQ(*knownOptimum("cap41"), 1040444.375);
+    EXPECT_DOUBLE_EQ(*knownOptimum(instancePath("cap134.txt")), 928941.750);
+    EXPECT_DOUBLE_EQ(*knownOptimum("capa.txt"), 19240822.449);
+    EXPECT_FALSE(knownOptimum("random.txt").has_value());
+}
+
+TEST(BatchRunnerTest, SolvesEveryCombinationInOrder) {
+    BatchRunOptions options;
+    options.instances = {instancePath("cap7[12].txt"), instancePath("cap42.txt")};
+    options.seeds = {1, 2};
+    options.timeLimits = {0, 5};
+    options.threads = 3;
+    std::vector<BatchRunResult> results = BatchRunner(options).run();
+
+    ASSERT_EQ(results.size(), 12u);
+    EXPECT_EQ(results[0].instance, instancePath("cap42.txt"));
+    EXPECT_FALSE(results[0].error.empty());
+    EXPECT_EQ(results[4].instance, instancePath("cap71.txt"));
+    EXPECT_EQ(results[4].seed, 1u);
+    EXPECT_EQ(results[5].timeLimit, 5.0);
+    EXPECT_EQ(results[6].seed, 2u);
+
+    for (size_t r = 4; r < results.size(); ++r) {
+        const BatchRunResult &result = results[r];
+        EXPECT_TRUE(result.error.empty()) << result.error;
+        ASSERT_TRUE(result.gap.has_value());
+        // Los costos escalados se redondean, así que la brecha puede ser apenas negativa
+        EXPECT_GT(*result.gap, -0.01);
+        EXPECT_LT(*result.gap, 5.0);
+        EXPECT_NEAR(result.objective, *result.optimum * (1 + *result.gap / 100), 1e-6);
+        EXPECT_GT(result.iterations, 0);
+        EXPECT_LE(result.timeToBest, result.totalTime);
+    }
+}
+
+TEST(BatchRunnerTest, WritesCsvAndJson) {
+    BatchRunResult solved;
+    solved.instance = "cap41.txt";
+    solved.seed = 3;
+    solved.objective = 1040444;
+    solved.optimum = 1040444.375;
+    solved.gap = -0.00003;
+    BatchRunResult failed;
+    failed.instance = "bad, \"file\".txt";
+    failed.error = "line 2: bad";
+
+    std::ostringstream csv;
+    BatchRunner::writeCsv({solved, failed}, csv);
+    EXPECT_NE(csv.str().find("instance,seed,time_limit,objective"), std::string::npos);
+    EXPECT_NE(csv.str().find("cap41.txt,3,0,1040444,1040444.375,"), std::string::npos);
+    EXPECT_NE(csv.str().find("\"bad, \"\"file\"\".txt\""), std::string::npos);
+
+    std::ostringstream json;
+    BatchRunner::writeJson({solved, failed}, json);
+    EXPECT_NE(json.str().find("\"objective\": 1040444,"), std::string::npos);
+    EXPECT_NE(json.str().find("\"instance\": \"bad, \\\"file\\\".txt\""), std::string::npos);
+    EXPECT_NE(json.str().find("\"error\": \"line 2: bad\""), std::string::npos);
+
+    EXPECT_THROW(BatchRunner(BatchRunOptions{}), std::invalid_argument);
+}
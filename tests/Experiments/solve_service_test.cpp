@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+#include "Experiments/solve_service.h"
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+std::string instancePath(const std::string &name) {
+    return std::string(CFLP_INSTANCES_DIR) + "/Beasley/" + name;
+}
+
+std::map<std::string, std::string> fields(const std::string &response) {
+    std::map<std::string, std::string> parsed;
+    std::istringstream lines(response);
+    std::string line;
+    while (std::getline(lines, line)) {
+        size_t equals = line.find('=');
+        parsed[line.substr(0, equals)] = line.substr(equals + 1);
+    }
+    return parsed;
+}
+
+std::string solveRequest(const std::string &id, unsigned seed) {
+    return "id=" + id + "\ninstance=" + instancePath("cap41.txt") + "\nseed=" + std::to_string(seed) +
+           "\ntime_limit=0.2\n";
+}
+
+} // namespace
+
+TEST(SolveRequestTest, ParsesKeysAndRejectsBadValues) {
+    SolveRequest request = SolveRequest::parse("id=7\r\ninstance=a.txt\nseed=3\ntime_limit=1.5\ninitial=0110\n\n");
+    EXPECT_EQ(request.id, "7");
+    EXPECT_EQ(request.command, "solve");
+    EXPECT_EQ(request.instance, "a.txt");
+    EXPECT_EQ(request.seed, 3u);
+    EXPECT_DOUBLE_EQ(request.timeLimit, 1.5);
+    EXPECT_EQ(request.initial, (std::vector<int>{0, 1, 1, 0}));
+    EXPECT_TRUE(request.allocationCosts);
+
+    EXPECT_THROW(SolveRequest::parse("seed=x"), std::invalid_argument);
+    EXPECT_THROW(SolveRequest::parse("time_limit=-1"), std::invalid_argument);
+    EXPECT_THROW(SolveRequest::parse("colour=red"), std::invalid_argument);
+    EXPECT_THROW(SolveRequest::parse("command=dance"), std::invalid_argument);
+    EXPECT_THROW(SolveRequest::parse("initial=012"), std::invalid_argument);
+}
+
+TEST(SolveServiceTest, KeepsInstancesResidentAcrossRequests) {
+    SolveService service(2);
+    std::map<std::string, std::string> first = fields(service.handle(solveRequest("a", 1)));
+    std::map<std::string, std::string> second = fields(service.handle(solveRequest("b", 2)));
+
+    EXPECT_EQ(first["id"], "a");
+    EXPECT_EQ(first["status"], "ok");
+    EXPECT_EQ(first["open"].size(), 16u);
+    EXPECT_NEAR(std::stod(first["objective"]), 1040444.375, 1040444.375 * 0.05);
+    EXPECT_EQ(second["status"], "ok");
+    EXPECT_EQ(service.residentInstances(), 1u);
+    EXPECT_EQ(service.servedRequests(), 2u);
+
+    std::map<std::string, std::string> missing = fields(service.handle("id=c\ninstance=/no/such/file.txt\n"));
+    EXPECT_EQ(missing["id"], "c");
+    EXPECT_EQ(missing["status"], "error");
+    EXPECT_FALSE(missing["error"].empty());
+    EXPECT_EQ(service.residentInstances(), 1u);
+}
+
+TEST(SolveServiceTest, ServesFramesFromAStream) {
+    int requests[2];
+    int responses[2];
+    ASSERT_EQ(pipe(requests), 0);
+    ASSERT_EQ(pipe(responses), 0);
+    SolveService::writeFrame(requests[1], solveRequest("1", 1));
+    SolveService::writeFrame(requests[1], "id=2\ncommand=stats\n");
+    close(requests[1]);
+
+    SolveService service(2);
+    service.serveStream(requests[0], responses[1]);
+    close(requests[0]);
+    close(responses[1]);
+
+    std::map<std::string, std::map<std::string, std::string>> byId;
+    std::string payload;
+    while (SolveService::readFrame(responses[0], payload)) {
+        std::map<std::string, std::string> response = fields(payload);
+        byId[response["id"]] = response;
+    }
+    close(responses[0]);
+
+    ASSERT_EQ(byId.size(), 2u);
+    EXPECT_EQ(byId["1"]["status"], "ok");
+    EXPECT_EQ(byId["2"]["status"], "ok");
+    EXPECT_TRUE(byId["2"].count("resident_instances"));
+}
+
+TEST(SolveServiceTest, ServesConcurrentClientsOnAUnixSocket) {
+    const std::string path = ::testing::TempDir() + "cflp_solve_service_test.sock";
+    SolveService service(2);
+    std::thread server([&] { service.serveSocket(path); });
+
+    auto connectClient = [&path]() {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::snprintf(address.sun_path, sizeof(address.sun_path), "%s", path.c_str());
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        for (int attempt = 0; attempt < 100; ++attempt) {
+            if (connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0) {
+                return fd;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        close(fd);
+        return -1;
+    };
+
+    std::vector<std::string> statuses(2);
+    std::vector<std::thread> clients;
+    for (int c = 0; c < 2; ++c) {
+        clients.emplace_back([&, c] {
+            int fd = connectClient();
+            if (fd < 0) {
+                return;
+            }
+            SolveService::writeFrame(fd, solveRequest(std::to_string(c), c + 1));
+            std::string payload;
+            if (SolveService::readFrame(fd, payload)) {
+                statuses[c] = fields(payload)["status"];
+            }
+            close(fd);
+        });
+    }
+    for (std::thread &client : clients) {
+        client.join();
+    }
+
+    int control = connectClient();
+    ASSERT_GE(control, 0);
+    SolveService::writeFrame(control, "command=shutdown\n");
+    std::string payload;
+    ASSERT_TRUE(SolveService::readFrame(control, payload));
+    close(control);
+    server.join();
+
+    EXPECT_EQ(statuses, (std::vector<std::string>{"ok", "ok"}));
+    EXPECT_EQ(service.residentInstances(), 1u);
+    EXPECT_TRUE(service.isShutDown());
+}
+
+TEST(SolveServiceTest, JoinsTheThreadsOfClosedConnections) {
+    const std::string path = ::testing::TempDir() + "cflp_solve_service_reap_test.sock";
+    SolveService service(1);
+    std::thread server([&] { service.serveSocket(path); });
+
+    auto exchange = [&path](const std::string &request) {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::snprintf(address.sun_path, sizeof(address.sun_path), "%s", path.c_str());
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        for (int attempt = 0; attempt < 100; ++attempt) {
+            if (connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0) {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        SolveService::writeFrame(fd, request);
+        std::string payload;
+        bool answered = SolveService::readFrame(fd, payload);
+        close(fd);
+        return answered;
+    };
+
+    for (int c = 0; c < 20; ++c) {
+        ASSERT_TRUE(exchange("id=" + std::to_string(c) + "\ncommand=stats\n"));
+    }
+    // Los hilos de las conexiones cerradas se unen sin esperar al apagado
+    for (int wait = 0; wait < 50 && service.connectionThreads() > 0; ++wait) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    EXPECT_EQ(service.connectionThreads(), 0u);
+
+    ASSERT_TRUE(exchange("command=shutdown\n"));
+    server.join();
+    EXPECT_EQ(service.connectionThreads(), 0u);
+}
+
+TEST(SolveServiceTest, DoesNotReplaceARegularFileWithTheSocket) {
+    const std::string path = ::testing::TempDir() + "cflp_solve_service_not_a_socket.txt";
+    std::ofstream(path) << "keep me\n";
+
+    SolveService service(1);
+    EXPECT_THROW(service.serveSocket(path), std::runtime_error);
+
+    std::ifstream kept(path);
+    std::string line;
+    ASSERT_TRUE(std::getline(kept, line));
+    EXPECT_EQ(line, "keep me");
+    std::remove(path.c_str());
+}
@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+#include "InstanceBuilder/geo_points.h"
+#include <cmath>
+
+TEST(GeoPointsTest, HaversineMatchesKnownDistances) {
+    // Ciudad de México - Nueva York, aproximadamente 3360 km
+    EXPECT_NEAR(GeoPoints::haversineKm(19.4333, -99.1333, 40.6943, -73.9249), 3360.0, 15.0);
+    EXPECT_DOUBLE_EQ(GeoPoints::haversineKm(45.0, 10.0, 45.0, 10.0), 0.0);
+    // Un cuarto de meridiano
+    EXPECT_NEAR(GeoPoints::haversineKm(0.0, 0.0, 90.0, 0.0), GeoPoints::kEarthRadiusKm * M_PI / 2, 1e-6);
+}
+
+TEST(GeoPointsTest, RowKernelAgreesWithHaversine) {
+    std::vector<std::pair<double, double>> coordinates = {
+        {19.4333, -99.1333}, {40.6943, -73.9249}, {34.1141, -118.4068},
+        {43.7417, -79.3733}, {20.6767, -103.3475}, {-33.8688, 151.2093}, {19.4333, -99.1333}};
+
+    GeoPoints points;
+    for (const auto &[latitude, longitude] : coordinates) {
+        points.add(latitude, longitude);
+    }
+    ASSERT_EQ(points.size(), coordinates.size());
+
+    std::vector<double> distances(points.size());
+    for (size_t i = 0; i < coordinates.size(); ++i) {
+        points.distancesFrom(i, distances.data());
+        for (size_t j = 0; j < coordinates.size(); ++j) {
+            double expected = GeoPoints::haversineKm(coordinates[i].first, coordinates[i].second,
+                                                     coordinates[j].first, coordinates[j].second);
+            EXPECT_NEAR(distances[j], expected, 1e-6) << i << " -> " << j;
+        }
+    }
+
+    points.distancesFrom(19.4333, -99.1333, distances.data());
+    EXPECT_NEAR(distances[0], 0.0, 1e-6);
+    EXPECT_NEAR(distances[6], 0.0, 1e-6);
+}
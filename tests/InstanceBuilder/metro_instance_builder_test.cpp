@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include "InstanceBuilder/metro_instance_builder.h"
+#include <cmath>
+#include <algorithm>
+#include <functional>
+
+namespace {
+
+std::string databasePath() {
+    return std::string(CFLP_DB_DIR) + "/Metro_CDMX.sqlite3";
+}
+
+} // namespace
+
+TEST(MetroInstanceBuilderTest, LoadsStationsAndConnections) {
+    MetroNetwork network = MetroInstanceBuilder(databasePath()).loadNetwork();
+    ASSERT_EQ(network.stations.size(), 163u);
+    EXPECT_EQ(network.connections.size(), 183u);
+    ASSERT_EQ(network.lengths.size(), 183u);
+    for (double length : network.lengths) {
+        EXPECT_GT(length, 0.0);
+        EXPECT_EQ(length, std::floor(length));
+    }
+    for (size_t j = 1; j < network.stations.size(); ++j) {
+        EXPECT_LT(network.stations[j - 1].id, network.stations[j].id);
+    }
+
+    StationGraph graph = MetroInstanceBuilder::buildGraph(network, MetroDistance::Hops);
+    for (const std::vector<double> &row : graph.allPairs()) {
+        for (double distance : row) {
+            EXPECT_TRUE(std::isfinite(distance));
+        }
+    }
+}
+
+TEST(MetroInstanceBuilderTest, BuildsNetworkDistanceInstance) {
+    MetroInstanceBuilder builder(databasePath());
+    MetroNetwork network = builder.loadNetwork();
+
+    MetroOptions options;
+    options.distance = MetroDistance::Hops;
+    CFLPProblem problem = builder.build(options);
+    ASSERT_EQ(problem.getCapacities().size(), 163u);
+    ASSERT_EQ(problem.getDemands().size(), 163u);
+
+    const auto &costs = problem.getCostMatrix();
+    for (size_t i = 0; i < costs.size(); ++i) {
+        EXPECT_EQ(costs[i][i], 0);
+        for (size_t j = 0; j < costs.size(); ++j) {
+            EXPECT_EQ(costs[i][j], costs[j][i]);
+        }
+    }
+    for (size_t j = 0; j < network.stations.size(); ++j) {
+        EXPECT_EQ(problem.getDemands()[j],
+                  static_cast<int>(std::ceil(network.stations[j].annualFlow / options.flowPerDemandUnit)));
+    }
+}
+
+TEST(MetroInstanceBuilderTest, UsesTrackLengthsInMetres) {
+    MetroInstanceBuilder builder(databasePath());
+    MetroNetwork network = builder.loadNetwork();
+    CFLPProblem problem = builder.build(MetroOptions{});
+
+    // Con todas las estaciones como candidatas, dos estaciones contiguas distan a lo más la longitud de su tramo
+    const auto &costs = problem.getCostMatrix();
+    bool someDirect = false;
+    for (size_t e = 0; e < network.connections.size(); ++e) {
+        auto [a, b] = network.connections[e];
+        EXPECT_LE(costs[a][b], network.lengths[e]);
+        EXPECT_GT(costs[a][b], 0);
+        someDirect = someDirect || costs[a][b] == network.lengths[e];
+    }
+    EXPECT_TRUE(someDirect);
+
+    network.lengths.pop_back();
+    EXPECT_THROW(MetroInstanceBuilder::buildGraph(network, MetroDistance::Metres), std::invalid_argument);
+}
+
+TEST(MetroInstanceBuilderTest, OpensServicePointsAtBusiestStations) {
+    MetroInstanceBuilder builder(databasePath());
+    MetroNetwork network = builder.loadNetwork();
+
+    MetroOptions options;
+    options.facilities = 10;
+    BasicCFLPProblem<double> problem = builder.buildAs<double>(options);
+    ASSERT_EQ(problem.getCapacities().size(), 10u);
+
+    int64_t total = 0;
+    for (int demand : problem.getDemands()) {
+        total += demand;
+    }
+    EXPECT_GE(10 * static_cast<int64_t>(problem.getCapacities()[0]), total);
+
+    // Cada candidato está a distancia cero de su propia estación, que es de las diez más concurridas
+    std::vector<int64_t> flows;
+    for (const MetroStation &station : network.stations) {
+        flows.push_back(station.annualFlow);
+    }
+    std::sort(flows.begin(), flows.end(), std::greater<int64_t>());
+    size_t previous = 0;
+    for (size_t i = 0; i < problem.getCostMatrix().size(); ++i) {
+        const auto &row = problem.getCostMatrix()[i];
+        size_t own = std::find(row.begin(), row.end(), 0.0) - row.begin();
+        ASSERT_LT(own, row.size());
+        EXPECT_GE(network.stations[own].annualFlow, flows[9]);
+        if (i > 0) {
+            EXPECT_GT(own, previous);
+        }
+        previous = own;
+    }
+}
+
+TEST(MetroInstanceBuilderTest, RejectsDisconnectedNetwork) {
+    MetroNetwork network;
+    network.stations = {{1, "A", 1000000, 19.4, -99.1}, {2, "B", 2000000, 19.5, -99.2}};
+    EXPECT_THROW(MetroInstanceBuilder::buildFromNetwork<int>(network, MetroOptions{}), std::invalid_argument);
+
+    network.connections = {{0, 1}};
+    network.lengths = {1250.0};
+    BasicCFLPProblem<int> problem = MetroInstanceBuilder::buildFromNetwork<int>(network, MetroOptions{});
+    EXPECT_EQ(problem.getCostMatrix()[0][1], 1250);
+}
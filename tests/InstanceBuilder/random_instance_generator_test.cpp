@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "InstanceBuilder/random_instance_generator.h"
+#include "Reader/beasley_instance_reader.h"
+#include "Reader/binary_instance_reader.h"
+#include <numeric>
+
+namespace {
+
+RandomInstanceOptions smallOptions(uint64_t seed, unsigned threads) {
+    RandomInstanceOptions options;
+    options.facilities = 23;
+    // Más de un bloque de clientes, para que importe la semilla de cada bloque
+    options.customers = RandomInstanceGenerator::kBlockSize + 300;
+    options.capacityRatio = 2.5;
+    options.seed = seed;
+    options.threads = threads;
+    return options;
+}
+
+} // namespace
+
+TEST(RandomInstanceGeneratorTest, FollowsCornuejolsDistributions) {
+    RandomInstanceGenerator generator(smallOptions(7, 0));
+    CFLPProblem problem = generator.generate();
+
+    for (int demand : problem.getDemands()) {
+        EXPECT_GE(demand, 5);
+        EXPECT_LE(demand, 35);
+    }
+    double totalCapacity = std::accumulate(problem.getCapacities().begin(), problem.getCapacities().end(), 0.0);
+    double ratio = totalCapacity / problem.getTotalDemand();
+    EXPECT_GE(ratio, 2.5);
+    EXPECT_LT(ratio, 2.5 + 23.0 / problem.getTotalDemand());
+
+    for (size_t i = 0; i < problem.getCapacities().size(); ++i) {
+        double root = std::sqrt(problem.getCapacities()[i]);
+        EXPECT_GE(problem.getOpeningCosts()[i], 100.0 * root - 0.001);
+        EXPECT_LE(problem.getOpeningCosts()[i], 90.0 + 110.0 * root + 0.001);
+    }
+    for (size_t j = 0; j < problem.getDemands().size(); ++j) {
+        EXPECT_LE(generator.cost(0, j), 10.0 * problem.getDemands()[j] * std::sqrt(2.0));
+    }
+}
+
+TEST(RandomInstanceGeneratorTest, SeedAloneDeterminesInstance) {
+    CFLPProblem serial = RandomInstanceGenerator(smallOptions(42, 1)).generate();
+    CFLPProblem parallel = RandomInstanceGenerator(smallOptions(42, 4)).generate();
+    EXPECT_EQ(serial.getCostMatrix(), parallel.getCostMatrix());
+    EXPECT_EQ(serial.getCapacities(), parallel.getCapacities());
+    EXPECT_EQ(serial.getDemands(), parallel.getDemands());
+    EXPECT_EQ(serial.getOpeningCosts(), parallel.getOpeningCosts());
+
+    CFLPProblem other = RandomInstanceGenerator(smallOptions(43, 4)).generate();
+    EXPECT_NE(serial.getDemands(), other.getDemands());
+    EXPECT_NE(serial.getCostMatrix(), other.getCostMatrix());
+}
+
+TEST(RandomInstanceGeneratorTest, WritersMatchGeneratedInstance) {
+    RandomInstanceGenerator generator(smallOptions(3, 3));
+    BasicCFLPProblem<int64_t> exact = generator.generateAs<int64_t>();
+    CFLPProblem problem = generator.generate();
+
+    std::string text = ::testing::TempDir() + "random.txt";
+    generator.writeText(text);
+    BasicCFLPProblem<int64_t> fromText = BeasleyInstanceReader().readInstanceAs<int64_t>(text);
+    EXPECT_EQ(fromText.getCostMatrix(), exact.getCostMatrix());
+    EXPECT_EQ(fromText.getCapacities(), exact.getCapacities());
+    EXPECT_EQ(fromText.getDemands(), exact.getDemands());
+    EXPECT_EQ(fromText.getOpeningCosts(), exact.getOpeningCosts());
+
+    std::string binary = ::testing::TempDir() + "random.cflpb";
+    generator.writeBinary(binary);
+    CFLPProblem fromBinary = BinaryInstanceReader().readInstance(binary);
+    EXPECT_EQ(fromBinary.getCostMatrix(), problem.getCostMatrix());
+    EXPECT_EQ(fromBinary.getCapacities(), problem.getCapacities());
+    EXPECT_EQ(fromBinary.getDemands(), problem.getDemands());
+    EXPECT_EQ(fromBinary.getOpeningCosts(), problem.getOpeningCosts());
+
+    // Texto y binario guardan los mismos decimales
+    EXPECT_EQ(BinaryInstanceReader().readInstanceAs<int64_t>(binary).getCostMatrix(), exact.getCostMatrix());
+}
+
+TEST(RandomInstanceGeneratorTest, RejectsInvalidOptions) {
+    RandomInstanceOptions options;
+    options.facilities = 0;
+    EXPECT_THROW(RandomInstanceGenerator{options}, std::invalid_argument);
+
+    options.facilities = 10;
+    options.capacityRatio = 0.5;
+    EXPECT_THROW(RandomInstanceGenerator{options}, std::invalid_argument);
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include "InstanceBuilder/station_graph.h"
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+// Camino 0-1-2-3 con un atajo largo 0-3 y un nodo aislado 4
+StationGraph pathGraph(bool weighted) {
+    std::vector<StationGraph::Edge> edges = {{0, 1}, {1, 2}, {2, 3}, {0, 3}};
+    if (!weighted) {
+        return StationGraph(5, edges);
+    }
+    return StationGraph(5, edges, {1.0, 2.0, 1.5, 10.0});
+}
+
+} // namespace
+
+TEST(StationGraphTest, CountsHopsWithoutWeights) {
+    StationGraph graph = pathGraph(false);
+    EXPECT_EQ(graph.getNodeCount(), 5u);
+    EXPECT_EQ(graph.getEdgeCount(), 4u);
+
+    std::vector<double> distances;
+    graph.distancesFrom(0, distances);
+    ASSERT_EQ(distances.size(), 5u);
+    EXPECT_DOUBLE_EQ(distances[0], 0.0);
+    EXPECT_DOUBLE_EQ(distances[1], 1.0);
+    EXPECT_DOUBLE_EQ(distances[2], 2.0);
+    EXPECT_DOUBLE_EQ(distances[3], 1.0);
+    EXPECT_EQ(distances[4], std::numeric_limits<double>::infinity());
+}
+
+TEST(StationGraphTest, FollowsShortestWeightedPath) {
+    StationGraph graph = pathGraph(true);
+    std::vector<double> distances;
+    graph.distancesFrom(0, distances);
+    EXPECT_DOUBLE_EQ(distances[1], 1.0);
+    EXPECT_DOUBLE_EQ(distances[2], 3.0);
+    EXPECT_DOUBLE_EQ(distances[3], 4.5);
+    EXPECT_EQ(distances[4], std::numeric_limits<double>::infinity());
+}
+
+TEST(StationGraphTest, ParallelSearchesMatchSerialOnes) {
+    StationGraph graph = pathGraph(true);
+    std::vector<std::vector<double>> all = graph.allPairs(3);
+    ASSERT_EQ(all.size(), 5u);
+
+    std::vector<double> distances;
+    for (size_t i = 0; i < all.size(); ++i) {
+        graph.distancesFrom(i, distances);
+        EXPECT_EQ(all[i], distances);
+        for (size_t j = 0; j < all.size(); ++j) {
+            EXPECT_EQ(all[i][j], all[j][i]);
+        }
+    }
+
+    std::vector<std::vector<double>> rows = graph.distancesFrom({3, 1}, 2);
+    EXPECT_EQ(rows[0], all[3]);
+    EXPECT_EQ(rows[1], all[1]);
+}
+
+TEST(StationGraphTest, RejectsInvalidEdges) {
+    EXPECT_THROW(StationGraph(2, {{0, 2}}), std::invalid_argument);
+    EXPECT_THROW(StationGraph(2, {{0, 1}}, {-1.0}), std::invalid_argument);
+    EXPECT_THROW(StationGraph(2, {{0, 1}}, {1.0, 2.0}), std::invalid_argument);
+}
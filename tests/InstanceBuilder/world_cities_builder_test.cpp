@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include "InstanceBuilder/geo_points.h"
+#include "InstanceBuilder/world_cities_builder.h"
+
+namespace {
+
+std::string databasePath() {
+    return std::string(CFLP_DB_DIR) + "/Mexico-US-Canada.sqlite3";
+}
+
+} // namespace
+
+TEST(WorldCitiesInstanceBuilderTest, LoadsFilteredCitiesByPopulation) {
+    WorldCitiesOptions options;
+    options.countries = {"Mexico"};
+    options.customers = 20;
+    std::vector<City> cities = WorldCitiesInstanceBuilder(databasePath()).loadCities(options);
+
+    ASSERT_EQ(cities.size(), 20u);
+    EXPECT_EQ(cities[0].name, "Mexico City");
+    for (size_t j = 0; j < cities.size(); ++j) {
+        EXPECT_EQ(cities[j].country, "Mexico");
+        if (j > 0) {
+            EXPECT_LE(cities[j].population, cities[j - 1].population);
+        }
+    }
+
+    options.countries = {"Canada", "United States"};
+    options.customers = 0;
+    options.minPopulation = 1000000;
+    for (const City &city : WorldCitiesInstanceBuilder(databasePath()).loadCities(options)) {
+        EXPECT_GE(city.population, 1000000);
+        EXPECT_NE(city.country, "Mexico");
+    }
+}
+
+TEST(WorldCitiesInstanceBuilderTest, BuildsGreatCircleInstance) {
+    WorldCitiesOptions options;
+    options.customers = 300;
+    options.facilities = 30;
+    options.threads = 4;
+    WorldCitiesInstanceBuilder builder(databasePath());
+    std::vector<City> cities = builder.loadCities(options);
+    BasicCFLPProblem<double> problem = builder.buildAs<double>(options);
+
+    ASSERT_EQ(problem.getCapacities().size(), 30u);
+    ASSERT_EQ(problem.getDemands().size(), 300u);
+    EXPECT_EQ(problem.getDemands()[0], (cities[0].population + 999) / 1000);
+    EXPECT_GE(static_cast<int64_t>(problem.getCapacities()[0]) * 30, 3 * static_cast<int64_t>(problem.getTotalDemand()));
+
+    for (size_t i : {0u, 7u, 29u}) {
+        for (size_t j : {0u, 11u, 150u, 299u}) {
+            EXPECT_NEAR(problem.getCostMatrix()[i][j],
+                        GeoPoints::haversineKm(cities[i].latitude, cities[i].longitude,
+                                               cities[j].latitude, cities[j].longitude),
+                        1e-6);
+        }
+        EXPECT_DOUBLE_EQ(problem.getCostMatrix()[i][i], 0.0);
+    }
+
+    // Un solo hilo produce la misma matriz
+    options.threads = 1;
+    EXPECT_EQ(builder.buildAs<double>(options).getCostMatrix(), problem.getCostMatrix());
+}
+
+TEST(WorldCitiesInstanceBuilderTest, ReportsMissingDatabaseAndEmptySelection) {
+    EXPECT_THROW(WorldCitiesInstanceBuilder("does_not_exist.sqlite3").loadCities({}), std::runtime_error);
+
+    WorldCitiesOptions options;
+    options.countries = {"Atlantis"};
+    EXPECT_THROW(WorldCitiesInstanceBuilder(databasePath()).build(options), std::invalid_argument);
+}
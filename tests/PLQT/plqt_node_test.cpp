@@ -108,3 +108,15 @@ TEST(PLQTNodeTest, ToStringRepresentation) {
     std::string expected = "PLQTNode(data: 101, order: 3)";
     EXPECT_EQ(node.toString(), expected);
 }
+
+TEST(PLQTNodeTest, DataViewAccessors) {
+    std::vector<int> data = {1, 0, 1, 1};
+    PLQTNode node(data);
+
+    const std::vector<int>& view = node.getData();
+    EXPECT_EQ(&view, &node.getData());
+    EXPECT_EQ(node.getDimension(), 4u);
+    EXPECT_EQ(node.getValue(0), 1);
+    EXPECT_EQ(node.getValue(1), 0);
+    EXPECT_EQ(node.getValue(3), 1);
+}
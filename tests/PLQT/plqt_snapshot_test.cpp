@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+#include "PLQT/plqt.h"
+#include "PLQT/plqt_snapshot.h"
+#include <fstream>
+
+namespace {
+
+std::string snapshotPath(const std::string &name) {
+    return ::testing::TempDir() + name;
+}
+
+PLQT makeBinaryTree(std::vector<std::vector<int>> &inserted) {
+    const int dim = 10;
+    std::vector<int> data(dim, 0);
+    PLQT plqt(dim, new PLQTNode(data));
+    plqt.getRoot()->setCost(1000);
+    inserted = {data};
+
+    for (int step = 0; step < 60; ++step) {
+        data[(step * 3) % dim] ^= 1;
+        PLQTNode *node = plqt.insert(data);
+        node->setCost(1000 - step);
+        node->setFingerprint(static_cast<uint64_t>(step) * 31u);
+        inserted.push_back(data);
+    }
+    return plqt;
+}
+
+} // namespace
+
+TEST(PLQTSnapshotTest, MappedLookupMatchesTree) {
+    std::vector<std::vector<int>> inserted;
+    PLQT plqt = makeBinaryTree(inserted);
+    std::string path = snapshotPath("plqt_lookup.snapshot");
+    PLQTSnapshot::write(plqt, path);
+
+    PLQTSnapshot snapshot(path);
+    EXPECT_EQ(snapshot.getDimension(), 10);
+
+    for (const auto &vec : inserted) {
+        EXPECT_TRUE(snapshot.contains(vec));
+        EXPECT_EQ(snapshot.lookupCost(vec), plqt.lookupCost(vec));
+    }
+    std::vector<int> absent(10, 1);
+    EXPECT_EQ(snapshot.contains(absent), plqt.search(absent) != nullptr);
+}
+
+TEST(PLQTSnapshotTest, ToTreeRestoresStructureAndCosts) {
+    std::vector<std::vector<int>> inserted;
+    PLQT plqt = makeBinaryTree(inserted);
+    std::string path = snapshotPath("plqt_restore.snapshot");
+    PLQTSnapshot::write(plqt, path);
+
+    PLQT restored = PLQTSnapshot(path).toTree();
+    EXPECT_TRUE(restored.getRoot()->isDeepEqual(*plqt.getRoot()));
+
+    for (const auto &vec : inserted) {
+        PLQTNode *node = restored.search(vec);
+        ASSERT_NE(node, nullptr);
+        EXPECT_EQ(node->getCost(), plqt.search(vec)->getCost());
+        EXPECT_EQ(node->getFingerprint(), plqt.search(vec)->getFingerprint());
+    }
+
+    // The restored tree keeps accepting inserts
+    std::vector<int> fresh = {1, 1, 1, 1, 1, 0, 0, 0, 0, 1};
+    restored.insert(fresh);
+    EXPECT_NE(restored.search(fresh), nullptr);
+}
+
+TEST(PLQTSnapshotTest, StoresNonBinaryData) {
+    PLQT plqt(3, new PLQTNode({3, 36, 27}));
+    plqt.insert({92, 76, 39});
+    plqt.insert({59, 81, 72});
+    std::string path = snapshotPath("plqt_ints.snapshot");
+    PLQTSnapshot::write(plqt, path);
+
+    PLQTSnapshot snapshot(path);
+    EXPECT_TRUE(snapshot.contains({59, 81, 72}));
+    EXPECT_FALSE(snapshot.contains({59, 81, 71}));
+    EXPECT_TRUE(snapshot.toTree().getRoot()->isDeepEqual(*plqt.getRoot()));
+}
+
+TEST(PLQTSnapshotTest, ThrowsOnInvalidFile) {
+    std::string path = snapshotPath("plqt_invalid.snapshot");
+    std::ofstream(path) << "not a snapshot at all, just some text";
+
+    EXPECT_THROW(PLQTSnapshot snapshot(path), std::runtime_error);
+    EXPECT_THROW(PLQTSnapshot snapshot(snapshotPath("missing.snapshot")), std::runtime_error);
+}
+
+TEST(PLQTSnapshotTest, RejectsSnapshotsOfAnOlderVersion) {
+    std::vector<std::vector<int>> inserted;
+    PLQT plqt = makeBinaryTree(inserted);
+    std::string path = snapshotPath("plqt_old_version.snapshot");
+    PLQTSnapshot::write(plqt, path);
+
+    // Los registros de la versión 1 tienen el mismo tamaño: solo la versión los distingue
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        uint32_t version = 1;
+        file.seekp(8);
+        file.write(reinterpret_cast<const char *>(&version), sizeof(version));
+    }
+    EXPECT_THROW(PLQTSnapshot snapshot(path), std::runtime_error);
+}
+
+TEST(PLQTSnapshotTest, RecordsTheInstanceFingerprint) {
+    std::vector<std::vector<int>> inserted;
+    PLQT plqt = makeBinaryTree(inserted);
+    std::string path = snapshotPath("plqt_instance.snapshot");
+
+    PLQTSnapshot::write(plqt, path, 0x0123456789abcdefULL);
+    EXPECT_EQ(PLQTSnapshot(path).getInstanceFingerprint(), 0x0123456789abcdefULL);
+    PLQTSnapshot::write(plqt, path);
+    EXPECT_EQ(PLQTSnapshot(path).getInstanceFingerprint(), 0u);
+}
+
+TEST(PLQTSnapshotTest, RejectsCorruptHeadersAndLinks) {
+    std::vector<std::vector<int>> inserted;
+    PLQT plqt = makeBinaryTree(inserted);
+    std::string path = snapshotPath("plqt_corrupt.snapshot");
+
+    // Cabecera de 40 bytes (nodeCount en 16, packed en 24); cada registro de 40 bytes empieza con
+    // parent, firstChild y nextSibling
+    auto patch = [&path](std::streamoff offset, auto value) {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(offset);
+        file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    };
+    const std::streamoff records = 40, recordSize = 40;
+
+    PLQTSnapshot::write(plqt, path);
+    patch(records + 4, uint32_t(1000000));
+    EXPECT_THROW(PLQTSnapshot snapshot(path), std::runtime_error);
+
+    PLQTSnapshot::write(plqt, path);
+    patch(records + recordSize + 8, uint32_t(1));
+    EXPECT_THROW(PLQTSnapshot snapshot(path), std::runtime_error);
+
+    PLQTSnapshot::write(plqt, path);
+    patch(records + 2 * recordSize, uint32_t(5));
+    EXPECT_THROW(PLQTSnapshot snapshot(path), std::runtime_error);
+
+    // Tamaños que desbordan 64 bits al multiplicarse
+    PLQTSnapshot::write(plqt, path);
+    patch(12, uint32_t(0xFFFFFFFFu));
+    patch(16, uint64_t(0xFFFFFFFEu));
+    patch(24, uint32_t(0));
+    EXPECT_THROW(PLQTSnapshot snapshot(path), std::runtime_error);
+}
+
+TEST(PLQTSnapshotTest, RoundTripsWideTrees) {
+    const int dim = 130;
+    std::vector<int> data(dim, 0);
+    PLQT plqt(dim, new PLQTNode(data));
+    std::vector<std::vector<int>> inserted = {data};
+    for (int step = 0; step < 80; ++step) {
+        data[(step * 41) % dim] ^= 1;
+        plqt.insert(data)->setCost(step);
+        inserted.push_back(data);
+    }
+
+    std::string path = snapshotPath("plqt_wide.snapshot");
+    PLQTSnapshot::write(plqt, path);
+    PLQTSnapshot snapshot(path);
+    for (const auto &vec : inserted) {
+        EXPECT_TRUE(snapshot.contains(vec));
+        EXPECT_EQ(snapshot.lookupCost(vec), plqt.lookupCost(vec));
+    }
+    EXPECT_TRUE(snapshot.toTree().getRoot()->isDeepEqual(*plqt.getRoot()));
+}
@@ -204,4 +204,106 @@ TEST(PLQTSearchTest, SearchNodeNotFound)
     std::vector<int> notFoundData = {100, 200, 300};
     PLQTNode* foundNode = plqt.search(notFoundData);
     EXPECT_EQ(foundNode, nullptr);
-}
\ No newline at end of file
+}
+TEST(PLQTSearchTest, SearchFindsEveryInsertedBinaryVector)
+{
+    const int dim = 12;
+    std::vector<int> data(dim, 0);
+    PLQT plqt(dim, new PLQTNode(data));
+
+    std::vector<std::vector<int>> inserted = {data};
+    for (int step = 0; step < 200; ++step)
+    {
+        data[(step * 7) % dim] ^= 1;
+        plqt.insert(data);
+        inserted.push_back(data);
+    }
+
+    for (const auto &vec : inserted)
+    {
+        PLQTNode *found = plqt.search(vec);
+        ASSERT_NE(found, nullptr);
+        EXPECT_EQ(found->getData(), vec);
+    }
+
+    std::vector<int> missing(dim, 1);
+    missing[0] = 0;
+    missing[1] = 0;
+    bool wasInserted = false;
+    for (const auto &vec : inserted)
+    {
+        wasInserted = wasInserted || vec == missing;
+    }
+    EXPECT_EQ(plqt.search(missing) != nullptr, wasInserted);
+}
+
+TEST(PLQTCostMemoTest, LookupCostReturnsStoredCost)
+{
+    std::vector<int> root = {0, 1, 0, 1};
+    PLQT plqt(4, new PLQTNode(root));
+    plqt.getRoot()->setCost(120);
+
+    std::vector<int> visited = {1, 1, 0, 1};
+    PLQTNode *node = plqt.insert(visited);
+    EXPECT_FALSE(plqt.lookupCost(visited).has_value());
+
+    node->setCost(95);
+    node->setFingerprint(42);
+
+    ASSERT_TRUE(plqt.lookupCost(visited).has_value());
+    EXPECT_EQ(*plqt.lookupCost(visited), 95);
+    EXPECT_EQ(*plqt.lookupCost(root), 120);
+    EXPECT_EQ(plqt.search(visited)->getFingerprint(), 42u);
+    EXPECT_FALSE(plqt.lookupCost({1, 1, 1, 1}).has_value());
+}
+
+TEST(PLQTCostMemoTest, MoveAssignmentTransfersOwnership)
+{
+    PLQT target;
+    PLQT source(3, new PLQTNode({0, 1, 0}));
+    source.insert({1, 1, 0})->setCost(7);
+
+    target = std::move(source);
+
+    EXPECT_EQ(target.getDimension(), 3);
+    EXPECT_EQ(source.getRoot(), nullptr);
+    ASSERT_TRUE(target.lookupCost({1, 1, 0}).has_value());
+    EXPECT_EQ(*target.lookupCost({1, 1, 0}), 7);
+}
+
+TEST(PLQTWideTest, InsertAndSearchAboveSixtyFourDimensions)
+{
+    const int dim = 200;
+    std::vector<int> data(dim, 0);
+    PLQT plqt(dim, new PLQTNode(data));
+
+    std::vector<std::vector<int>> inserted = {data};
+    for (int step = 0; step < 300; ++step)
+    {
+        data[(step * 37 + step / 5) % dim] ^= 1;
+        plqt.insert(data);
+        inserted.push_back(data);
+    }
+
+    for (const auto &vec : inserted)
+    {
+        PLQTNode *found = plqt.search(vec);
+        ASSERT_NE(found, nullptr);
+        EXPECT_EQ(found->getData(), vec);
+        EXPECT_EQ(plqt.insert(vec), found);
+    }
+
+    // Siblings stay ordered by their full successor key
+    PLQTNode *child = plqt.getRoot()->getFirstChild();
+    while (child != nullptr && child->getNextSibling() != nullptr)
+    {
+        PLQTNode *next = child->getNextSibling();
+        std::vector<uint64_t> key(next->getSuccessorWordCount());
+        for (size_t w = 0; w < key.size(); ++w)
+        {
+            key[w] = next->getSuccessorWord(w);
+        }
+        EXPECT_LT(child->compareSuccessor(key.data(), key.size()), 0);
+        child = next;
+    }
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include "Reader/beasley_instance_reader.h"
+#include <filesystem>
+#include <fstream>
+
+namespace {
+
+std::string instancePath(const std::string &name) {
+    return std::string(CFLP_INSTANCES_DIR) + "/Beasley/" + name;
+}
+
+std::string writeTemp(const std::string &name, const std::string &content) {
+    std::string path = ::testing::TempDir() + name;
+    std::ofstream(path) << content;
+    return path;
+}
+
+} // namespace
+
+TEST(BeasleyInstanceReaderTest, ReadsNumericCapacities) {
+    BeasleyInstanceReader reader;
+    CFLPProblem problem = reader.readInstance(instancePath("cap41.txt"));
+
+    ASSERT_EQ(problem.getCapacities().size(), 16u);
+    ASSERT_EQ(problem.getDemands().size(), 50u);
+    EXPECT_EQ(problem.getCapacities()[0], 5000);
+    EXPECT_DOUBLE_EQ(problem.getOpeningCosts()[0], 7500.0);
+    EXPECT_DOUBLE_EQ(problem.getOpeningCosts()[10], 0.0);
+    EXPECT_EQ(problem.getDemands()[0], 146);
+    EXPECT_EQ(problem.getDemands()[1], 87);
+    // 6739.72500 and 10355.05000 are truncated
+    EXPECT_EQ(problem.getCostMatrix()[0][0], 6739);
+    EXPECT_EQ(problem.getCostMatrix()[1][0], 10355);
+    EXPECT_EQ(problem.getTotalDemand(), 58268);
+}
+
+TEST(BeasleyInstanceReaderTest, ReadsCapacityPlaceholder) {
+    CFLPProblem problem = BeasleyInstanceReader().readInstance(instancePath("capa.txt"));
+    ASSERT_EQ(problem.getCapacities().size(), 100u);
+    ASSERT_EQ(problem.getDemands().size(), 1000u);
+    EXPECT_EQ(problem.getCapacities()[0], 8000);
+    EXPECT_DOUBLE_EQ(problem.getOpeningCosts()[0], 21412000.0);
+
+    CFLPProblem custom = BeasleyInstanceReader(12000).readInstance(instancePath("capa.txt"));
+    EXPECT_EQ(custom.getCapacities()[99], 12000);
+}
+
+TEST(BeasleyInstanceReaderTest, LoadsEveryShippedInstance) {
+    BeasleyInstanceReader reader;
+    int loaded = 0;
+    for (const auto &entry : std::filesystem::directory_iterator(std::string(CFLP_INSTANCES_DIR) + "/Beasley")) {
+        // The shipped cap42 has its opening costs split in two ("1250 0.00000") and cap92
+        // starts with a stray "0\. \n" prefix; both must be rejected rather than misread.
+        std::string name = entry.path().filename().string();
+        if (name == "cap42.txt" || name == "cap92.txt") {
+            EXPECT_THROW(reader.readInstance(entry.path().string()), std::runtime_error);
+            continue;
+        }
+        CFLPProblem problem = reader.readInstance(entry.path().string());
+        EXPECT_GT(problem.getCapacities().size(), 0u) << entry.path();
+        EXPECT_EQ(problem.getCostMatrix().size(), problem.getCapacities().size()) << entry.path();
+        ++loaded;
+    }
+    EXPECT_EQ(loaded, 38);
+}
+
+TEST(BeasleyInstanceReaderTest, ReportsMalformedInputWithLine) {
+    std::string path = writeTemp("malformed_beasley.txt",
+                                 "2 2\n"
+                                 "10 5.0\n"
+                                 "10 abc\n"
+                                 "3\n1.0 2.0\n4\n3.0 4.0\n");
+    try {
+        BeasleyInstanceReader().readInstance(path);
+        FAIL() << "Expected std::runtime_error";
+    } catch (const std::runtime_error &error) {
+        std::string message = error.what();
+        EXPECT_NE(message.find(":3:"), std::string::npos) << message;
+        EXPECT_NE(message.find("abc"), std::string::npos) << message;
+    }
+}
+
+TEST(BeasleyInstanceReaderTest, ReportsTruncatedInputAndUnknownPlaceholder) {
+    std::string truncated = writeTemp("truncated_beasley.txt", "2 2\n10 5.0\n10 5.0\n3\n1.0\n");
+    EXPECT_THROW(BeasleyInstanceReader().readInstance(truncated), std::runtime_error);
+
+    std::string placeholder = writeTemp("placeholder_beasley.txt", "1 1\ncapacity 5.0\n3\n1.0\n");
+    EXPECT_THROW(BeasleyInstanceReader().readInstance(placeholder), std::runtime_error);
+    EXPECT_EQ(BeasleyInstanceReader(7).readInstance(placeholder).getCapacities()[0], 7);
+
+    EXPECT_THROW(BeasleyInstanceReader().readInstance("does_not_exist.txt"), std::runtime_error);
+}
+
+TEST(BeasleyInstanceReaderTest, ReadsExactCostsWithWiderCostTypes) {
+    BeasleyInstanceReader reader;
+    BasicCFLPProblem<int64_t> fixed = reader.readInstanceAs<int64_t>(instancePath("cap41.txt"));
+    BasicCFLPProblem<double> exact = reader.readInstanceAs<double>(instancePath("cap41.txt"));
+
+    // 6739.72500 and 10355.05000
+    EXPECT_EQ(fixed.getCostMatrix()[0][0], 673972500);
+    EXPECT_EQ(fixed.getCostMatrix()[1][0], 1035505000);
+    EXPECT_DOUBLE_EQ(exact.getCostMatrix()[0][0], 6739.725);
+
+    std::vector<int> allOpen(16, 1);
+    fixed.initializeSubproblem(allOpen);
+    exact.initializeSubproblem(allOpen);
+    EXPECT_NEAR(CostTraits<int64_t>::toDouble(fixed.getCurrentCost()), exact.getCurrentCost(), 1e-3);
+}
+
+TEST(BeasleyInstanceReaderTest, StreamsSparseInstance) {
+    BeasleyInstanceReader reader;
+    CFLPProblem dense = reader.readInstance(instancePath("cap71.txt"));
+    SparseInstance sparse = reader.readSparseInstanceAs<int>(instancePath("cap71.txt"), 3);
+
+    EXPECT_EQ(sparse.capacities, dense.getCapacities());
+    EXPECT_EQ(sparse.demands, dense.getDemands());
+    EXPECT_EQ(sparse.openingCosts, dense.getOpeningCosts());
+    EXPECT_EQ(sparse.costs.getStoredEntryCount(), 50u * 3u);
+
+    // A column reloaded from the file matches the dense matrix
+    size_t customer = 17;
+    EXPECT_TRUE(sparse.costs.loadColumn(customer));
+    for (size_t i = 0; i < dense.getCapacities().size(); ++i) {
+        EXPECT_EQ(sparse.costs.getCost(i, customer), dense.getCostMatrix()[i][customer]);
+    }
+
+    std::vector<int> open(16, 0);
+    for (int i : {0, 3, 5, 9, 12}) {
+        open[i] = 1;
+    }
+    CFLPTransportSubproblem denseSub(dense.getCostMatrix(), dense.getCapacities(), dense.getDemands(), open);
+    CFLPTransportSubproblem sparseSub(sparse.costs, sparse.capacities, sparse.demands, open);
+    denseSub.solve();
+    sparseSub.solve();
+    EXPECT_EQ(sparseSub.getTotalCost(), denseSub.getTotalCost());
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "Reader/beasley_instance_reader.h"
+#include "Reader/binary_instance.h"
+#include "Reader/binary_instance_reader.h"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+namespace {
+
+std::string tempPath(const std::string &name) {
+    return ::testing::TempDir() + name;
+}
+
+} // namespace
+
+TEST(BinaryInstanceTest, RoundTripsBeasleyInstance) {
+    CFLPProblem original = BeasleyInstanceReader().readInstance(std::string(CFLP_INSTANCES_DIR) + "/Beasley/cap131.txt");
+    std::string path = tempPath("cap131.cflpb");
+    BinaryInstance::write(original, path);
+
+    CFLPProblem loaded = BinaryInstanceReader().readInstance(path);
+    EXPECT_EQ(loaded.getCostMatrix(), original.getCostMatrix());
+    EXPECT_EQ(loaded.getCapacities(), original.getCapacities());
+    EXPECT_EQ(loaded.getDemands(), original.getDemands());
+    EXPECT_EQ(loaded.getOpeningCosts(), original.getOpeningCosts());
+    EXPECT_EQ(loaded.getTotalDemand(), original.getTotalDemand());
+}
+
+TEST(BinaryInstanceTest, KeepsFractionalCosts) {
+    std::string text = std::string(CFLP_INSTANCES_DIR) + "/Beasley/cap41.txt";
+    std::string path = tempPath("cap41_exact.cflpb");
+    BasicCFLPProblem<double> original = BeasleyInstanceReader().readInstanceAs<double>(text);
+    BinaryInstance::write(original, path);
+
+    BasicCFLPProblem<double> loaded = BinaryInstanceReader().readInstanceAs<double>(path);
+    EXPECT_EQ(loaded.getCostMatrix(), original.getCostMatrix());
+    EXPECT_DOUBLE_EQ(loaded.getCostMatrix()[0][0], 6739.725);
+
+    // El punto fijo de int64_t ida y vuelta, y los costos enteros truncados como en el texto
+    BasicCFLPProblem<int64_t> fixed = BeasleyInstanceReader().readInstanceAs<int64_t>(text);
+    EXPECT_EQ(BinaryInstanceReader().readInstanceAs<int64_t>(path).getCostMatrix(), fixed.getCostMatrix());
+    BinaryInstance::write(fixed, path);
+    EXPECT_EQ(BinaryInstanceReader().readInstanceAs<int64_t>(path).getCostMatrix(), fixed.getCostMatrix());
+    EXPECT_EQ(BinaryInstanceReader().readInstance(path).getCostMatrix(),
+              BeasleyInstanceReader().readInstance(text).getCostMatrix());
+}
+
+TEST(BinaryInstanceTest, ViewsBlocksWithoutCopying) {
+    CFLPProblem original({{1, 2, 3}, {4, 5, 6}}, {10, 20}, {7, 8, 9}, {100.5, 200.25});
+    std::string path = tempPath("small.cflpb");
+    BinaryInstance::write(original, path);
+
+    BinaryInstance view(path);
+    ASSERT_EQ(view.getFacilityCount(), 2u);
+    ASSERT_EQ(view.getCustomerCount(), 3u);
+    EXPECT_EQ(view.getCapacities()[1], 20);
+    EXPECT_EQ(view.getDemands()[2], 9);
+    EXPECT_DOUBLE_EQ(view.getOpeningCosts()[0], 100.5);
+    EXPECT_EQ(view.getCostRow(1)[0], 4);
+    EXPECT_EQ(view.getCostRow(1)[2], 6);
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(view.getCapacities()) % 64, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(view.getDemands()) % 64, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(view.getOpeningCosts()) % 64, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(view.getCostRow(0)) % 64, 0u);
+}
+
+TEST(BinaryInstanceTest, RejectsInvalidFiles) {
+    std::string text = tempPath("not_binary.cflpb");
+    std::ofstream(text) << "16 50\n5000 7500.0\n";
+    EXPECT_THROW(BinaryInstance{text}, std::runtime_error);
+
+    CFLPProblem original({{1, 2}}, {10}, {3, 4}, {5.0});
+    std::string truncated = tempPath("truncated.cflpb");
+    BinaryInstance::write(original, truncated);
+    std::filesystem::resize_file(truncated, std::filesystem::file_size(truncated) - 4);
+    EXPECT_THROW(BinaryInstanceReader().readInstance(truncated), std::runtime_error);
+
+    EXPECT_THROW(BinaryInstance{tempPath("missing.cflpb")}, std::runtime_error);
+
+    // Dimensiones cuyo producto desborda: la validación no puede dar la vuelta
+    std::string huge = tempPath("huge.cflpb");
+    BinaryInstance::write(original, huge);
+    {
+        std::fstream file(huge, std::ios::in | std::ios::out | std::ios::binary);
+        uint64_t dimension = 0x7FFFFFFF;
+        file.seekp(16);
+        file.write(reinterpret_cast<const char *>(&dimension), sizeof(dimension));
+        file.write(reinterpret_cast<const char *>(&dimension), sizeof(dimension));
+    }
+    EXPECT_THROW(BinaryInstance{huge}, std::runtime_error);
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include "Reader/beasley_instance_reader.h"
+#include "Reader/instance_batch_loader.h"
+#include <mutex>
+#include <thread>
+
+namespace {
+
+std::string beasleyDir() {
+    return std::string(CFLP_INSTANCES_DIR) + "/Beasley";
+}
+
+} // namespace
+
+TEST(InstanceBatchLoaderTest, ListsDirectoryAndGlobInSortedOrder) {
+    std::vector<std::string> all = InstanceBatchLoader::listFiles(beasleyDir());
+    EXPECT_EQ(all.size(), 40u);
+    EXPECT_TRUE(std::is_sorted(all.begin(), all.end()));
+
+    std::vector<std::string> cap13 = InstanceBatchLoader::listFiles(beasleyDir() + "/cap13?.txt");
+    ASSERT_EQ(cap13.size(), 4u);
+    EXPECT_EQ(cap13[0], beasleyDir() + "/cap131.txt");
+    EXPECT_EQ(cap13[3], beasleyDir() + "/cap134.txt");
+
+    EXPECT_TRUE(InstanceBatchLoader::listFiles(beasleyDir() + "/*.cflpb").empty());
+    EXPECT_THROW(InstanceBatchLoader::listFiles(beasleyDir() + "/missing/*.txt"), std::runtime_error);
+}
+
+TEST(InstanceBatchLoaderTest, LoadsConcurrentlyInDeterministicOrder) {
+    InstanceBatchLoader batch(beasleyDir() + "/cap[0-9]*.txt", 4);
+    ASSERT_EQ(batch.size(), 37u);
+
+    BeasleyInstanceReader reader;
+    for (size_t k = 0; k < batch.size(); ++k) {
+        std::string name = batch.getPath(k).substr(batch.getPath(k).find_last_of('/') + 1);
+        if (name == "cap42.txt" || name == "cap92.txt") {
+            EXPECT_THROW(batch.get(k), std::runtime_error);
+            continue;
+        }
+        CFLPProblem problem = batch.get(k);
+        EXPECT_EQ(problem.getCostMatrix(), reader.readInstance(batch.getPath(k)).getCostMatrix()) << name;
+    }
+    EXPECT_THROW(batch.get(0), std::future_error);
+}
+
+TEST(InstanceBatchLoaderTest, UsesCustomLoaderInPathOrder) {
+    std::mutex mutex;
+    std::vector<std::string> loaded;
+    {
+        InstanceBatchLoader batch({"b", "a", "c"}, 1, [&](const std::string &path) {
+            std::lock_guard<std::mutex> lock(mutex);
+            loaded.push_back(path);
+            return CFLPProblem({{1}}, {1}, {1}, {1.0});
+        });
+        EXPECT_EQ(batch.getPath(0), "a");
+        EXPECT_EQ(batch.get(0).getTotalDemand(), 1);
+        while (!batch.isReady(2)) {
+            std::this_thread::yield();
+        }
+        EXPECT_EQ(batch.get(2).getTotalDemand(), 1);
+        EXPECT_FALSE(batch.isReady(2));
+    }
+    ASSERT_FALSE(loaded.empty());
+    EXPECT_EQ(loaded[0], "a");
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include "Reader/auto_instance_reader.h"
+#include "Reader/beasley_instance_reader.h"
+#include "Reader/binary_instance.h"
+#include "Reader/instance_format.h"
+#include "Reader/sectioned_instance_reader.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+// 3 facilidades, 4 clientes; el costo de i a j es 10 * i + j + 0.5
+const std::vector<int> kCapacities = {40, 50, 60};
+const std::vector<double> kOpeningCosts = {100.5, 200.0, 300.25};
+const std::vector<int> kDemands = {7, 8, 9, 10};
+
+std::string cost(size_t i, size_t j) {
+    return std::to_string(10 * i + j) + ".5";
+}
+
+std::string writeTemp(const std::string &name, const std::string &content) {
+    std::string path = ::testing::TempDir() + name;
+    std::ofstream(path) << content;
+    return path;
+}
+
+std::string facilityPairs() {
+    std::ostringstream text;
+    for (size_t i = 0; i < kCapacities.size(); ++i) {
+        text << kCapacities[i] << " " << kOpeningCosts[i] << "\n";
+    }
+    return text.str();
+}
+
+std::string demandLine() {
+    std::ostringstream text;
+    for (int demand : kDemands) {
+        text << demand << " ";
+    }
+    return text.str() + "\n";
+}
+
+std::string facilityRows() {
+    std::string text;
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            text += cost(i, j) + " ";
+        }
+        text += "\n";
+    }
+    return text;
+}
+
+std::string beasley() {
+    std::string text = "3 4\n" + facilityPairs();
+    for (size_t j = 0; j < 4; ++j) {
+        text += std::to_string(kDemands[j]) + "\n";
+        for (size_t i = 0; i < 3; ++i) {
+            text += cost(i, j) + " ";
+        }
+        text += "\n";
+    }
+    return text;
+}
+
+std::string holmberg() {
+    return "3 4\n" + facilityPairs() + demandLine() + facilityRows();
+}
+
+std::string yang() {
+    std::string text = "3 4\n" + facilityPairs() + demandLine();
+    for (size_t j = 0; j < 4; ++j) {
+        for (size_t i = 0; i < 3; ++i) {
+            text += cost(i, j) + " ";
+        }
+        text += "\n";
+    }
+    return text;
+}
+
+std::string tbed() {
+    return "3 4\n" + demandLine() + "40 50 60\n100.5 200 300.25\n" + facilityRows();
+}
+
+void expectSmallInstance(const CFLPProblem &problem) {
+    EXPECT_EQ(problem.getCapacities(), kCapacities);
+    EXPECT_EQ(problem.getOpeningCosts(), kOpeningCosts);
+    EXPECT_EQ(problem.getDemands(), kDemands);
+    ASSERT_EQ(problem.getCostMatrix().size(), 3u);
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            EXPECT_EQ(problem.getCostMatrix()[i][j], static_cast<int>(10 * i + j));
+        }
+    }
+}
+
+} // namespace
+
+TEST(SectionedInstanceReaderTest, ReadsEachLayout) {
+    expectSmallInstance(HolmbergInstanceReader().readInstance(writeTemp("holmberg.txt", holmberg())));
+    expectSmallInstance(YangInstanceReader().readInstance(writeTemp("yang.txt", yang())));
+    expectSmallInstance(TbedInstanceReader().readInstance(writeTemp("tbed.txt", tbed())));
+
+    BasicCFLPProblem<double> exact = TbedInstanceReader().readInstanceAs<double>(writeTemp("tbed.txt", tbed()));
+    EXPECT_DOUBLE_EQ(exact.getCostMatrix()[2][3], 23.5);
+}
+
+TEST(SectionedInstanceReaderTest, ReportsMalformedFiles) {
+    EXPECT_THROW(HolmbergInstanceReader().readInstance(writeTemp("short.txt", "3 4\n40 100\n")), std::runtime_error);
+    EXPECT_THROW(HolmbergInstanceReader().readInstance(writeTemp("extra.txt", holmberg() + "1\n")),
+                 std::runtime_error);
+    try {
+        TbedInstanceReader().readInstance(writeTemp("bad.txt", "3 4\n7 8 x 10\n"));
+        FAIL() << "expected an exception";
+    } catch (const std::runtime_error &error) {
+        EXPECT_NE(std::string(error.what()).find("bad.txt:2"), std::string::npos) << error.what();
+    }
+}
+
+TEST(InstanceFormatTest, DetectsFormatFromContent) {
+    EXPECT_EQ(detectInstanceFormat(writeTemp("b.txt", beasley())), InstanceFormat::Beasley);
+    EXPECT_EQ(detectInstanceFormat(writeTemp("h.txt", holmberg())), InstanceFormat::Holmberg);
+    EXPECT_EQ(detectInstanceFormat(writeTemp("y.txt", yang())), InstanceFormat::Yang);
+    EXPECT_EQ(detectInstanceFormat(writeTemp("t.txt", tbed())), InstanceFormat::Tbed);
+    EXPECT_EQ(detectInstanceFormat(std::string(CFLP_INSTANCES_DIR) + "/Beasley/cap41.txt"), InstanceFormat::Beasley);
+    for (const auto &entry : std::filesystem::directory_iterator(std::string(CFLP_INSTANCES_DIR) + "/Beasley")) {
+        std::string name = entry.path().filename().string();
+        if (name != "cap42.txt" && name != "cap92.txt") {
+            EXPECT_EQ(detectInstanceFormat(entry.path().string()), InstanceFormat::Beasley) << name;
+        }
+    }
+
+    // Demandas una por renglón en el formato de Holmberg
+    std::string oneDemandPerLine = "3 4\n" + facilityPairs() + "7\n8\n9\n10\n" + facilityRows();
+    EXPECT_EQ(detectInstanceFormat(writeTemp("h1.txt", oneDemandPerLine)), InstanceFormat::Holmberg);
+
+    EXPECT_THROW(detectInstanceFormat(writeTemp("junk.txt", "facilities customers\n")), std::runtime_error);
+}
+
+TEST(AutoInstanceReaderTest, ReadsEveryFormat) {
+    AutoInstanceReader reader;
+    expectSmallInstance(reader.readInstance(writeTemp("b.txt", beasley())));
+    expectSmallInstance(reader.readInstance(writeTemp("h.txt", holmberg())));
+    expectSmallInstance(reader.readInstance(writeTemp("y.txt", yang())));
+    expectSmallInstance(reader.readInstance(writeTemp("t.txt", tbed())));
+
+    CFLPProblem cap = BeasleyInstanceReader().readInstance(std::string(CFLP_INSTANCES_DIR) + "/Beasley/cap131.txt");
+    std::string binary = ::testing::TempDir() + "auto.cflpb";
+    BinaryInstance::write(cap, binary);
+    EXPECT_EQ(detectInstanceFormat(binary), InstanceFormat::Binary);
+    EXPECT_EQ(reader.readInstance(binary).getCostMatrix(), cap.getCostMatrix());
+    EXPECT_EQ(reader.readInstanceAs<double>(binary).getCostMatrix()[0][0], cap.getCostMatrix()[0][0]);
+}
@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include "Reader/text_scanner.h"
+
+namespace {
+
+TextScanner scannerFor(const std::string &text) {
+    return TextScanner(text.data(), text.data() + text.size(), "input");
+}
+
+} // namespace
+
+TEST(TextScannerTest, ParsesNumbersAcrossLines) {
+    std::string text = "  12 -3\n\n 4.25\t+7\r\n1e3\n";
+    TextScanner scanner = scannerFor(text);
+
+    EXPECT_EQ(scanner.nextInteger("a"), 12);
+    EXPECT_EQ(scanner.nextInteger("b"), -3);
+    EXPECT_EQ(scanner.line(), 3u);
+    EXPECT_DOUBLE_EQ(scanner.nextDouble("c"), 4.25);
+    EXPECT_EQ(scanner.nextInteger("d"), 7);
+    EXPECT_DOUBLE_EQ(scanner.nextDouble("e"), 1000.0);
+    EXPECT_TRUE(scanner.atEnd());
+}
+
+TEST(TextScannerTest, ConsumesWordsOnlyWhenTheyMatch) {
+    std::string text = "capacity 5 capacityX";
+    TextScanner scanner = scannerFor(text);
+
+    EXPECT_FALSE(scanner.consumeWord("cap"));
+    EXPECT_TRUE(scanner.consumeWord("capacity"));
+    EXPECT_EQ(scanner.nextInteger("value"), 5);
+    EXPECT_EQ(scanner.peekToken(), "capacityX");
+    EXPECT_FALSE(scanner.consumeWord("capacity"));
+}
+
+TEST(TextScannerTest, ErrorsNameSourceAndLine) {
+    std::string text = "1\n2\n3.5\n";
+    TextScanner scanner = scannerFor(text);
+    scanner.nextInteger("first");
+    scanner.nextInteger("second");
+
+    try {
+        scanner.nextInteger("third");
+        FAIL() << "Expected std::runtime_error";
+    } catch (const std::runtime_error &error) {
+        EXPECT_STREQ(error.what(), "input:3: expected third, found '3.5'");
+    }
+
+    scanner.nextDouble("third");
+    EXPECT_THROW(scanner.nextDouble("fourth"), std::runtime_error);
+}
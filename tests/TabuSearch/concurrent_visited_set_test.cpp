@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include "TabuSearch/concurrent_visited_set.h"
+#include <thread>
+
+namespace {
+
+std::vector<int> toBits(unsigned int value, int dimension) {
+    std::vector<int> bits(dimension);
+    for (int i = 0; i < dimension; ++i)
+        bits[i] = (value >> i) & 1u;
+    return bits;
+}
+
+} // namespace
+
+TEST(ConcurrentVisitedSetTest, ThrowsOnInvalidArguments) {
+    EXPECT_THROW(ConcurrentVisitedSet(0), std::invalid_argument);
+    EXPECT_THROW(ConcurrentVisitedSet(4, 0), std::invalid_argument);
+
+    ConcurrentVisitedSet set(4);
+    EXPECT_THROW(set.insert({1, 0}), std::invalid_argument);
+}
+
+TEST(ConcurrentVisitedSetTest, InsertContainsAndCost) {
+    ConcurrentVisitedSet set(5, 4);
+
+    EXPECT_TRUE(set.insert({1, 0, 1, 0, 0}));
+    EXPECT_FALSE(set.insert({1, 0, 1, 0, 0}));
+    EXPECT_TRUE(set.contains({1, 0, 1, 0, 0}));
+    EXPECT_FALSE(set.contains({1, 0, 1, 0, 1}));
+    EXPECT_FALSE(set.lookupCost({1, 0, 1, 0, 0}).has_value());
+
+    EXPECT_FALSE(set.insert({1, 0, 1, 0, 0}, 77));
+    EXPECT_EQ(set.lookupCost({1, 0, 1, 0, 0}), 77);
+
+    EXPECT_TRUE(set.insert({0, 0, 0, 0, 1}, 12));
+    EXPECT_FALSE(set.insert({0, 0, 0, 0, 1}, 99));
+    EXPECT_EQ(set.lookupCost({0, 0, 0, 0, 1}), 12);
+    EXPECT_EQ(set.size(), 2u);
+}
+
+TEST(ConcurrentVisitedSetTest, ConcurrentInsertsAreCountedOnce) {
+    const int dimension = 12;
+    const unsigned int range = 1u << 10;
+    ConcurrentVisitedSet set(dimension, 16);
+
+    std::vector<std::thread> workers;
+    std::vector<int> newlyInserted(4, 0);
+    for (int w = 0; w < 4; ++w) {
+        workers.emplace_back([&, w]() {
+            // Overlapping ranges: every value is inserted by two workers
+            for (unsigned int v = w * range / 2; v < w * range / 2 + range; ++v) {
+                if (set.insert(toBits(v, dimension), static_cast<int>(v)))
+                    newlyInserted[w]++;
+                EXPECT_TRUE(set.contains(toBits(v, dimension)));
+            }
+        });
+    }
+    for (auto &worker : workers)
+        worker.join();
+
+    int total = 0;
+    for (int count : newlyInserted)
+        total += count;
+
+    unsigned int distinct = 3 * range / 2 + range;
+    EXPECT_EQ(static_cast<unsigned int>(total), distinct);
+    EXPECT_EQ(set.size(), distinct);
+    EXPECT_EQ(set.lookupCost(toBits(range + 3, dimension)), static_cast<int>(range + 3));
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include "TabuSearch/convergence_trace.h"
+#include "TabuSearch/tabu_search_solver.h"
+#include "Reader/beasley_instance_reader.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+std::string instancePath(const std::string &name) {
+    return std::string(CFLP_INSTANCES_DIR) + "/Beasley/" + name;
+}
+
+} // namespace
+
+TEST(ConvergenceTraceTest, RecordsEveryMoveOfTheSolve) {
+    CFLPProblem problem = BeasleyInstanceReader().readInstance(instancePath("cap41.txt"));
+    TabuSearchSolver solver(problem);
+    ConvergenceTrace trace;
+    solver.setTrace(&trace);
+    solver.solve();
+
+    std::vector<TraceEvent> events;
+    trace.drain([&events](const TraceEvent &event) { events.push_back(event); });
+
+    ASSERT_EQ(static_cast<int>(events.size()), solver.getIterationCount());
+    EXPECT_EQ(trace.getDropped(), 0u);
+    for (size_t e = 1; e < events.size(); ++e) {
+        EXPECT_EQ(events[e].iteration, events[e - 1].iteration + 1);
+        EXPECT_LE(events[e].z00, events[e - 1].z00);
+        EXPECT_LE(events[e].z00, events[e].z0);
+    }
+    EXPECT_EQ(static_cast<double>(events.back().z00), solver.getBestCost());
+}
+
+TEST(ConvergenceTraceTest, CountsEventsDroppedWhenFull) {
+    ConvergenceTrace trace(2);
+    for (int k = 1; k <= 5; ++k) {
+        trace.record({k, 0, 10, 10, 10, true, false});
+    }
+    EXPECT_EQ(trace.getDropped(), 3u);
+
+    std::ostringstream csv;
+    EXPECT_EQ(trace.writeCsv(csv), 2u);
+    EXPECT_EQ(csv.str(), "1,0,open,0,10,10,10\n2,0,open,0,10,10,10\n");
+}
+
+TEST(ConvergenceTraceTest, DumperWritesTraceWhileSolving) {
+    const std::string path = ::testing::TempDir() + "convergence_trace_test.csv";
+    CFLPProblem problem = BeasleyInstanceReader().readInstance(instancePath("cap41.txt"));
+    TabuSearchSolver solver(problem);
+    ConvergenceTrace trace(16);
+    {
+        TraceDumper dumper(trace, path, std::chrono::milliseconds(1));
+        solver.setTrace(&trace);
+        solver.solve();
+    }
+
+    std::ifstream in(path);
+    std::string line;
+    std::getline(in, line);
+    EXPECT_EQ(line, "iteration,facility,move,tabu,zk,z0,z00");
+    size_t rows = 0;
+    while (std::getline(in, line)) {
+        ++rows;
+    }
+    EXPECT_EQ(rows + trace.getDropped(), static_cast<size_t>(solver.getIterationCount()));
+    std::remove(path.c_str());
+}
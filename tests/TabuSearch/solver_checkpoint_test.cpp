@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include "TabuSearch/solver_checkpoint.h"
+#include "TabuSearch/tabu_search_solver.h"
+#include "Reader/beasley_instance_reader.h"
+#include <cstring>
+#include <fstream>
+
+namespace {
+
+std::string instancePath(const std::string &name) {
+    return std::string(CFLP_INSTANCES_DIR) + "/Beasley/" + name;
+}
+
+} // namespace
+
+TEST(SolverCheckpointTest, RoundTripsTheSearchState) {
+    const std::string path = ::testing::TempDir() + "solver_checkpoint_roundtrip.ckpt";
+    CFLPProblem problem = BeasleyInstanceReader().readInstance(instancePath("cap41.txt"));
+    TabuSearchSolver solver(problem);
+    solver.solve();
+    solver.saveCheckpoint(path);
+
+    SolverCheckpoint saved = solver.getCheckpoint();
+    SolverCheckpoint loaded = SolverCheckpoint::read(path);
+    EXPECT_EQ(loaded.facilities, 16u);
+    EXPECT_EQ(loaded.customers, 50u);
+    EXPECT_EQ(loaded.k, saved.k);
+    EXPECT_EQ(loaded.k0, saved.k0);
+    EXPECT_EQ(loaded.c, saved.c);
+    EXPECT_EQ(loaded.c0, saved.c0);
+    EXPECT_EQ(loaded.l0, saved.l0);
+    EXPECT_EQ(loaded.l1, saved.l1);
+    EXPECT_EQ(loaded.z0, saved.z0);
+    EXPECT_EQ(loaded.zk, saved.zk);
+    EXPECT_EQ(loaded.z00, static_cast<int64_t>(solver.getBestCost()));
+    EXPECT_DOUBLE_EQ(loaded.timeToBest, solver.getTimeToBest());
+    EXPECT_EQ(loaded.generator, saved.generator);
+    EXPECT_EQ(loaded.y, saved.y);
+    EXPECT_EQ(loaded.yBest, solver.getBestSolution());
+    EXPECT_EQ(loaded.yP2, saved.yP2);
+    EXPECT_EQ(loaded.yP3, saved.yP3);
+    EXPECT_EQ(loaded.t, saved.t);
+    EXPECT_EQ(loaded.h, saved.h);
+    ASSERT_EQ(loaded.memory.size(), saved.memory.size());
+
+    PLQT memory = loaded.restoreMemory();
+    std::vector<SolverCheckpoint::MemoryNode> rebuilt = SolverCheckpoint::captureMemory(memory);
+    ASSERT_EQ(rebuilt.size(), saved.memory.size());
+    for (size_t i = 0; i < rebuilt.size(); ++i) {
+        EXPECT_EQ(rebuilt[i].bits, saved.memory[i].bits);
+        EXPECT_EQ(rebuilt[i].hasCost, saved.memory[i].hasCost);
+        EXPECT_EQ(rebuilt[i].cost, saved.memory[i].cost);
+        EXPECT_EQ(rebuilt[i].fingerprint, saved.memory[i].fingerprint);
+    }
+    EXPECT_EQ(memory.lookupCost(loaded.yBest), solver.getMemory().lookupCost(loaded.yBest));
+    std::remove(path.c_str());
+}
+
+TEST(SolverCheckpointTest, RejectsTruncatedAndForeignFiles) {
+    const std::string path = ::testing::TempDir() + "solver_checkpoint_truncated.ckpt";
+    CFLPProblem problem = BeasleyInstanceReader().readInstance(instancePath("cap41.txt"));
+    TabuSearchSolver solver(problem);
+    solver.solve();
+    solver.saveCheckpoint(path);
+
+    std::ifstream in(path, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    std::ofstream(path, std::ios::binary | std::ios::trunc).write(bytes.data(), bytes.size() - 3);
+    EXPECT_THROW(SolverCheckpoint::read(path), std::runtime_error);
+
+    // Conteos corruptos: se rechazan sin intentar reservar la memoria que piden
+    // (magic 8 + versión 4 + tamaños 8 + huella 8 + contadores 24 + costos 24 + tiempos 16)
+    const size_t generatorCount = 8 + 4 + 8 + 8 + 6 * 4 + 3 * 8 + 2 * 8;
+    std::string corrupt = bytes;
+    uint64_t huge = uint64_t(1) << 60;
+    std::memcpy(&corrupt[generatorCount], &huge, sizeof(huge));
+    std::ofstream(path, std::ios::binary | std::ios::trunc).write(corrupt.data(), corrupt.size());
+    EXPECT_THROW(SolverCheckpoint::read(path), std::runtime_error);
+
+    corrupt = bytes;
+    corrupt[generatorCount + 8] ^= 0x7f;
+    std::ofstream(path, std::ios::binary | std::ios::trunc).write(corrupt.data(), corrupt.size());
+    TabuSearchSolver garbled(problem);
+    EXPECT_THROW(garbled.resume(path), std::runtime_error);
+
+    std::ofstream(path, std::ios::trunc) << "not a checkpoint";
+    EXPECT_THROW(SolverCheckpoint::read(path), std::runtime_error);
+    EXPECT_THROW(SolverCheckpoint::read(path + ".missing"), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST(SolverCheckpointTest, ResumedSolveContinuesFromTheCheckpoint) {
+    const std::string path = ::testing::TempDir() + "solver_checkpoint_resume.ckpt";
+    CFLPProblem interrupted = BeasleyInstanceReader().readInstance(instancePath("cap41.txt"));
+    TabuSearchSolver first(interrupted);
+    first.setTimeLimit(0.05);
+    first.solve();
+    first.saveCheckpoint(path);
+    SolverCheckpoint saved = first.getCheckpoint();
+
+    CFLPProblem problem = BeasleyInstanceReader().readInstance(instancePath("cap41.txt"));
+    CFLPProblem other = BeasleyInstanceReader().readInstance(instancePath("cap101.txt"));
+    TabuSearchSolver wrongInstance(other);
+    EXPECT_THROW(wrongInstance.resume(path), std::invalid_argument);
+
+    // cap44 tiene los mismos tamaños que cap41: solo la huella de la instancia los distingue
+    CFLPProblem sameSize = BeasleyInstanceReader().readInstance(instancePath("cap44.txt"));
+    TabuSearchSolver sameSizeSolver(sameSize);
+    EXPECT_THROW(sameSizeSolver.resume(path), std::invalid_argument);
+
+    TabuSearchSolver resumed(problem);
+    resumed.resume(path);
+    resumed.solve();
+
+    EXPECT_GE(resumed.getIterationCount(), saved.k - 1);
+    EXPECT_LE(resumed.getBestCost(), static_cast<double>(saved.z00));
+    EXPECT_TRUE(resumed.getMemory().search(saved.y) != nullptr);
+    std::remove(path.c_str());
+}
+
+TEST(SolverCheckpointTest, WritesCheckpointsInTheBackgroundWhileSolving) {
+    const std::string path = ::testing::TempDir() + "solver_checkpoint_async.ckpt";
+    CFLPProblem problem = BeasleyInstanceReader().readInstance(instancePath("cap41.txt"));
+    TabuSearchSolver solver(problem);
+    solver.enableCheckpoints(path, 0.0);
+    EXPECT_THROW(solver.enableCheckpoints(path, -1.0), std::invalid_argument);
+    solver.solve();
+
+    SolverCheckpoint checkpoint = SolverCheckpoint::read(path);
+    EXPECT_EQ(checkpoint.facilities, 16u);
+    EXPECT_GE(checkpoint.z00, static_cast<int64_t>(solver.getBestCost()));
+    EXPECT_LE(checkpoint.k, solver.getIterationCount() + 1);
+    std::remove(path.c_str());
+}
+
+TEST(CheckpointWriterTest, ReportsWriteFailures) {
+    CheckpointWriter writer;
+    SolverCheckpoint checkpoint;
+    EXPECT_TRUE(writer.submit(checkpoint, "/no/such/directory/solver.ckpt"));
+    EXPECT_THROW(writer.wait(), std::runtime_error);
+    EXPECT_EQ(writer.getWrittenCount(), 0u);
+
+    const std::string path = ::testing::TempDir() + "checkpoint_writer_test.ckpt";
+    EXPECT_TRUE(writer.submit(checkpoint, path));
+    writer.wait();
+    EXPECT_EQ(writer.getWrittenCount(), 1u);
+    EXPECT_EQ(SolverCheckpoint::read(path).facilities, 0u);
+    std::remove(path.c_str());
+}
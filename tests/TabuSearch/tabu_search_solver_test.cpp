@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+#include "TabuSearch/tabu_search_solver.h"
+#include <random>
+#include <thread>
+
+namespace {
+
+CFLPProblem makeRandomProblem(int m, int n, unsigned int seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> cost(1, 60);
+    std::uniform_int_distribution<int> demand(5, 20);
+    std::uniform_int_distribution<int> fixed(50, 150);
+
+    std::vector<std::vector<int>> costMatrix(m, std::vector<int>(n));
+    for (auto &row : costMatrix)
+        for (auto &c : row)
+            c = cost(gen);
+
+    std::vector<int> demands(n);
+    int totalDemand = 0;
+    for (auto &d : demands) {
+        d = demand(gen);
+        totalDemand += d;
+    }
+
+    std::vector<int> capacities(m, 3 * totalDemand / m);
+    std::vector<double> openingCosts(m);
+    for (auto &f : openingCosts)
+        f = fixed(gen);
+
+    return CFLPProblem(costMatrix, capacities, demands, openingCosts);
+}
+
+int evaluate(int m, int n, unsigned int seed, const std::vector<int> &solution) {
+    CFLPProblem problem = makeRandomProblem(m, n, seed);
+    problem.initializeSubproblem(solution);
+    return problem.getCurrentCost();
+}
+
+} // namespace
+
+TEST(TabuSearchSolverTest, BestCostMatchesBestSolution) {
+    CFLPProblem problem = makeRandomProblem(8, 12, 7);
+    TabuSearchSolver solver(problem);
+    solver.solve();
+
+    std::vector<int> best = solver.getBestSolution();
+    ASSERT_EQ(best.size(), 8u);
+    EXPECT_EQ(static_cast<int>(solver.getBestCost()), evaluate(8, 12, 7, best));
+}
+
+TEST(TabuSearchSolverTest, MemoryMemoizesVisitedCosts) {
+    CFLPProblem problem = makeRandomProblem(8, 12, 11);
+    TabuSearchSolver solver(problem);
+    solver.solve();
+
+    std::vector<int> best = solver.getBestSolution();
+    std::optional<int> cached = solver.getMemory().lookupCost(best);
+    ASSERT_TRUE(cached.has_value());
+    EXPECT_EQ(*cached, evaluate(8, 12, 11, best));
+}
+
+TEST(TabuSearchSolverTest, RestoredMemoryKeepsVisitedConfigurations) {
+    std::string path = ::testing::TempDir() + "tabu_memory.snapshot";
+
+    CFLPProblem first = makeRandomProblem(8, 12, 5);
+    TabuSearchSolver solver(first);
+    solver.solve();
+    solver.saveMemory(path);
+    std::vector<int> best = solver.getBestSolution();
+
+    CFLPProblem second = makeRandomProblem(8, 12, 5);
+    TabuSearchSolver resumed(second);
+    resumed.restoreMemory(path);
+    EXPECT_EQ(resumed.getMemory().lookupCost(best), solver.getMemory().lookupCost(best));
+
+    resumed.solve();
+    EXPECT_NE(resumed.getMemory().search(best), nullptr);
+    EXPECT_LE(resumed.getBestCost(), evaluate(8, 12, 5, best));
+}
+
+TEST(TabuSearchSolverTest, RejectsMemoryOfAnotherInstance) {
+    std::string path = ::testing::TempDir() + "tabu_memory_other.snapshot";
+
+    CFLPProblem first = makeRandomProblem(8, 12, 5);
+    TabuSearchSolver solver(first);
+    solver.solve();
+    solver.saveMemory(path);
+
+    // Mismo tamaño, otros datos: los costos memorizados no le sirven
+    CFLPProblem other = makeRandomProblem(8, 12, 6);
+    TabuSearchSolver wrong(other);
+    EXPECT_THROW(wrong.restoreMemory(path), std::invalid_argument);
+    EXPECT_EQ(wrong.getMemory().getRoot(), nullptr);
+
+    CFLPProblem rescaled = makeRandomProblem(8, 12, 5);
+    rescaled.getOpeningCosts()[0] += 1.0;
+    TabuSearchSolver alsoWrong(rescaled);
+    EXPECT_THROW(alsoWrong.restoreMemory(path), std::invalid_argument);
+}
+
+TEST(TabuSearchSolverTest, SharedMemoryCollectsMovesOfEveryWorker) {
+    ConcurrentVisitedSet shared(8, 8);
+
+    std::vector<std::thread> workers;
+    std::vector<std::vector<int>> bests(2);
+    for (int w = 0; w < 2; ++w) {
+        workers.emplace_back([&, w]() {
+            CFLPProblem problem = makeRandomProblem(8, 12, 21);
+            TabuSearchSolver solver(problem);
+            solver.setSharedMemory(&shared);
+            solver.solve();
+            bests[w] = solver.getBestSolution();
+        });
+    }
+    for (auto &worker : workers)
+        worker.join();
+
+    EXPECT_TRUE(shared.contains(bests[0]));
+    EXPECT_TRUE(shared.contains(bests[1]));
+    EXPECT_GE(shared.size(), 2u);
+
+    CFLPProblem problem = makeRandomProblem(8, 12, 21);
+    TabuSearchSolver solver(problem);
+    ConcurrentVisitedSet wrongDimension(5);
+    EXPECT_THROW(solver.setSharedMemory(&wrongDimension), std::invalid_argument);
+}
+
+TEST(TabuSearchSolverTest, WarmStartsFromSavedSolution) {
+    std::string path = ::testing::TempDir() + "tabu_best.sol";
+
+    CFLPProblem first = makeRandomProblem(8, 12, 9);
+    TabuSearchSolver solver(first);
+    solver.solve();
+    solver.saveSolution(path, true);
+    std::vector<int> best = solver.getBestSolution();
+
+    CFLPSolution saved = CFLPSolution::read(path);
+    EXPECT_EQ(saved.getOpenFacilities(), best);
+    EXPECT_EQ(static_cast<int>(saved.getCost()), evaluate(8, 12, 9, best));
+    EXPECT_FALSE(saved.getAssignments().empty());
+
+    CFLPProblem second = makeRandomProblem(8, 12, 9);
+    TabuSearchSolver resumed(second);
+    resumed.warmStart(path);
+    resumed.solve();
+    EXPECT_LE(resumed.getBestCost(), saved.getCost());
+}
+
+TEST(TabuSearchSolverTest, RepairsInfeasibleInitialSolution) {
+    CFLPProblem problem = makeRandomProblem(8, 12, 13);
+    TabuSearchSolver solver(problem);
+    EXPECT_THROW(solver.setInitialSolution({1, 0}), std::invalid_argument);
+    EXPECT_THROW(solver.setInitialSolution({1, 0, 0, 0, 0, 0, 0, 2}), std::invalid_argument);
+
+    solver.setInitialSolution(std::vector<int>(8, 0));
+    solver.solve();
+    std::vector<int> best = solver.getBestSolution();
+    EXPECT_EQ(static_cast<int>(solver.getBestCost()), evaluate(8, 12, 13, best));
+}
+
+TEST(TabuSearchSolverTest, InitialSolutionOnlyAppliesToTheNextSolve) {
+    // Con un límite de tiempo mínimo la búsqueda termina en la configuración inicial
+    CFLPProblem reference = makeRandomProblem(8, 12, 23);
+    TabuSearchSolver greedy(reference);
+    greedy.setTimeLimit(1e-9);
+    greedy.solve();
+    ASSERT_NE(greedy.getBestSolution(), std::vector<int>(8, 1));
+
+    CFLPProblem problem = makeRandomProblem(8, 12, 23);
+    TabuSearchSolver solver(problem);
+    solver.setTimeLimit(1e-9);
+    solver.setInitialSolution(std::vector<int>(8, 1));
+    solver.solve();
+    EXPECT_EQ(solver.getBestSolution(), std::vector<int>(8, 1));
+
+    solver.solve();
+    EXPECT_EQ(solver.getBestSolution(), greedy.getBestSolution());
+}
+
+TEST(TabuSearchSolverTest, SeedAndTimeLimitControlTheSearch) {
+    CFLPProblem first = makeRandomProblem(10, 20, 17);
+    TabuSearchSolver seeded(first);
+    seeded.setSeed(99);
+    seeded.solve();
+
+    CFLPProblem second = makeRandomProblem(10, 20, 17);
+    TabuSearchSolver again(second);
+    again.setSeed(99);
+    again.solve();
+    EXPECT_EQ(seeded.getBestSolution(), again.getBestSolution());
+    EXPECT_EQ(seeded.getIterationCount(), again.getIterationCount());
+    EXPECT_GT(seeded.getIterationCount(), 0);
+    EXPECT_GE(seeded.getTimeToBest(), 0.0);
+
+    CFLPProblem limited = makeRandomProblem(10, 20, 17);
+    TabuSearchSolver stopped(limited);
+    stopped.setTimeLimit(1e-9);
+    stopped.solve();
+    EXPECT_LT(stopped.getIterationCount(), seeded.getIterationCount());
+    EXPECT_EQ(static_cast<int>(stopped.getBestCost()), evaluate(10, 20, 17, stopped.getBestSolution()));
+    EXPECT_THROW(stopped.setTimeLimit(-1), std::invalid_argument);
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "TransportProblem/cflp_tansport_problem.h"
+#include "Utils/memory_accounting.h"
 #include <random>
 
 namespace {
@@ -111,4 +112,106 @@ TEST(CFLPTransportSubproblemTest, ToggleFacilityOutOfRangeThrows) {
 
     EXPECT_THROW(sub.toggleFacility(-1), std::out_of_range);
     EXPECT_THROW(sub.toggleFacility(2), std::out_of_range);
-}*/
\ No newline at end of file
+}*/
+// --------- SPARSE COSTS ---------
+
+TEST(CFLPTransportSubproblemTest, SparseCostsMatchDenseOptimum) {
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<> costDist(1, 100);
+    std::uniform_int_distribution<> demandDist(1, 20);
+
+    const size_t m = 8, n = 25;
+    std::vector<std::vector<int>> dense(m, std::vector<int>(n));
+    for (auto &row : dense)
+        for (auto &value : row)
+            value = costDist(gen);
+    std::vector<int> demands(n);
+    for (auto &value : demands)
+        value = demandDist(gen);
+    std::vector<int> capacities(m, 120);
+
+    SparseCostMatrix sparse(m, 2);
+    for (size_t j = 0; j < n; ++j) {
+        std::vector<int> column(m);
+        for (size_t i = 0; i < m; ++i)
+            column[i] = dense[i][j];
+        sparse.appendCustomer(column);
+    }
+    sparse.setColumnLoader([&dense, m](size_t customer) {
+        std::vector<int> column(m);
+        for (size_t i = 0; i < m; ++i)
+            column[i] = dense[i][customer];
+        return column;
+    });
+
+    std::vector<int> open = {1, 0, 1, 1, 0, 1, 0, 1};
+    CFLPTransportSubproblem denseSub(dense, capacities, demands, open);
+    CFLPTransportSubproblem sparseSub(sparse, capacities, demands, open);
+    denseSub.solve();
+    sparseSub.solve();
+    EXPECT_EQ(sparseSub.getTotalCost(), denseSub.getTotalCost());
+
+    denseSub.toggleFacility(1);
+    sparseSub.toggleFacility(1);
+    denseSub.toggleFacility(3);
+    sparseSub.toggleFacility(3);
+    denseSub.solve();
+    sparseSub.solve();
+    EXPECT_EQ(sparseSub.getTotalCost(), denseSub.getTotalCost());
+}
+
+TEST(CFLPTransportSubproblemTest, SteadyStateTogglesDoNotAllocate) {
+    if (!MemoryAccounting::kEnabled) {
+        GTEST_SKIP() << "Built without CFLP_ALLOCATION_TRACKING";
+    }
+    const size_t m = 12, n = 30;
+    auto costs = generateRandomMatrix(m, n);
+    std::vector<int> capacities(m, 60);
+    std::vector<int> demands = generateRandomVector(n, 1, 10);
+    std::vector<int> open(m, 1);
+    open[3] = open[7] = 0;
+    CFLPTransportSubproblem subproblem(costs, capacities, demands, open);
+    subproblem.solve();
+
+    // Una primera pasada abre 3 y 7 y hace crecer las tablas a su tamaño final
+    for (int facility : {3, 7, 3, 7}) {
+        subproblem.toggleFacility(facility);
+        subproblem.solve();
+    }
+
+    MemoryAccounting::ThreadMeter meter;
+    for (int round = 0; round < 5; ++round) {
+        for (int facility : {3, 7, 3, 7}) {
+            subproblem.toggleFacility(facility);
+            subproblem.solve();
+        }
+    }
+    EXPECT_EQ(meter.read().total().allocations, 0u);
+}
+
+TEST(CFLPTransportSubproblemTest, SparseSubproblemOnlyReservesOpenRows) {
+    if (!MemoryAccounting::kEnabled) {
+        GTEST_SKIP() << "Built without CFLP_ALLOCATION_TRACKING";
+    }
+    const size_t m = 2000, n = 500;
+    auto columnOf = [m](size_t customer) {
+        std::vector<int> column(m);
+        for (size_t i = 0; i < m; ++i)
+            column[i] = static_cast<int>((i * 31 + customer * 17) % 97 + 1);
+        return column;
+    };
+    SparseCostMatrix sparse(m, 2);
+    for (size_t j = 0; j < n; ++j)
+        sparse.appendCustomer(columnOf(j));
+    sparse.setColumnLoader(columnOf);
+    std::vector<int> capacities(m, static_cast<int>(n));
+    std::vector<int> demands(n, 1);
+    std::vector<int> open(m, 0);
+    open[5] = 1;
+
+    MemoryAccounting::ThreadMeter meter;
+    CFLPTransportSubproblem subproblem(sparse, capacities, demands, open);
+
+    // Una tabla densa de m x (n + 1) celdas pediría decenas de MB
+    EXPECT_LT(meter.read().peakTotalBytes, int64_t(1) << 20);
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include "TransportProblem/sparse_cost_matrix.h"
+
+namespace {
+
+// Costos por cliente: columna j con una entrada por instalación
+const std::vector<std::vector<int>> kColumns = {
+    {9, 2, 7, 4},
+    {1, 8, 3, 6},
+    {5, 5, 5, 1}};
+
+SparseCostMatrix makeMatrix(size_t neighbors) {
+    SparseCostMatrix matrix(4, neighbors);
+    for (const auto &column : kColumns) {
+        matrix.appendCustomer(column);
+    }
+    return matrix;
+}
+
+} // namespace
+
+TEST(SparseCostMatrixTest, KeepsCheapestFacilitiesOfEachCustomer) {
+    SparseCostMatrix matrix = makeMatrix(2);
+
+    EXPECT_EQ(matrix.getCustomerCount(), 3u);
+    EXPECT_EQ(matrix.getStoredEntryCount(), 6u);
+    EXPECT_TRUE(matrix.isExact(1, 0));
+    EXPECT_TRUE(matrix.isExact(3, 0));
+    EXPECT_FALSE(matrix.isExact(0, 0));
+    EXPECT_EQ(matrix.getCost(1, 0), 2);
+    EXPECT_EQ(matrix.getCost(3, 0), 4);
+
+    // Ties keep the lowest facility index
+    EXPECT_TRUE(matrix.isExact(3, 2));
+    EXPECT_TRUE(matrix.isExact(0, 2));
+    EXPECT_FALSE(matrix.isExact(1, 2));
+}
+
+TEST(SparseCostMatrixTest, DroppedEntriesReturnLowerBound) {
+    SparseCostMatrix matrix = makeMatrix(2);
+
+    EXPECT_EQ(matrix.getCost(0, 0), 4);
+    EXPECT_EQ(matrix.getCost(2, 0), 4);
+    EXPECT_EQ(matrix.getCost(1, 1), 3);
+    EXPECT_EQ(matrix.getRow(0), (std::vector<int>{4, 1, 5}));
+
+    for (size_t j = 0; j < kColumns.size(); ++j) {
+        for (size_t i = 0; i < 4; ++i) {
+            EXPECT_LE(matrix.getCost(i, j), kColumns[j][i]);
+        }
+    }
+}
+
+TEST(SparseCostMatrixTest, LoadsExactColumnsOnDemand) {
+    SparseCostMatrix matrix = makeMatrix(1);
+    EXPECT_THROW(matrix.loadColumn(0), std::logic_error);
+
+    int loads = 0;
+    matrix.setColumnLoader([&loads](size_t customer) {
+        ++loads;
+        return kColumns[customer];
+    });
+
+    EXPECT_TRUE(matrix.loadColumn(1));
+    EXPECT_FALSE(matrix.loadColumn(1));
+    EXPECT_EQ(loads, 1);
+    EXPECT_TRUE(matrix.isExact(1, 1));
+    EXPECT_EQ(matrix.getCost(1, 1), 8);
+    EXPECT_EQ(matrix.getCost(1, 0), 2);
+}
+
+TEST(SparseCostMatrixTest, KeepsEverythingWhenNeighborsCoverFacilities) {
+    SparseCostMatrix matrix = makeMatrix(10);
+    EXPECT_EQ(matrix.getNeighborCount(), 4u);
+    EXPECT_FALSE(matrix.loadColumn(0));
+    EXPECT_EQ(matrix.getRow(2), (std::vector<int>{7, 3, 5}));
+}
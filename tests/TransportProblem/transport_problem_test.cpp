@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include "TransportProblem/transport_problem.h"
+#include "Utils/memory_accounting.h"
 #include <random>
+#include <limits>
 #include <numeric>
 
 namespace
@@ -293,4 +295,148 @@ TEST(TransportationProblemBalanceTest, SupplyGreaterThanDemand)
     {
         EXPECT_EQ(row.back(), 0);
     }
-}
\ No newline at end of file
+}
+TEST(TransportationProblemMethodTest, SolveHungarianMethodWithFractionalCosts)
+{
+    BasicTransportationProblem<double> problem(
+        {5, 4, 6},
+        {2, 3, 3, 5, 2},
+        {{5.25, 3.5, 4.0, 5.0, 6.0},
+         {2.0, 6.0, 5.0, 3.0, 2.75},
+         {6.0, 4.0, 3.0, 4.0, 4.0}});
+
+    problem.calculateTotalSupplyAndDemand();
+    problem.solveHungarianMethod();
+
+    BasicTransportationProblem<int64_t> scaled(
+        {5, 4, 6},
+        {2, 3, 3, 5, 2},
+        {{525, 350, 400, 500, 600},
+         {200, 600, 500, 300, 275},
+         {600, 400, 300, 400, 400}});
+
+    scaled.calculateTotalSupplyAndDemand();
+    scaled.solveHungarianMethod();
+
+    EXPECT_DOUBLE_EQ(problem.getTotalCost() * 100, static_cast<double>(scaled.getTotalCost()));
+}
+
+TEST(TransportationProblemMethodTest, TotalCostDoesNotOverflowInt)
+{
+    TransportationProblem problem({100000, 100000}, {100000, 100000}, {{30000, 40000}, {40000, 30000}});
+
+    problem.calculateTotalSupplyAndDemand();
+    problem.solveHungarianMethod();
+
+    EXPECT_EQ(problem.getTotalCost(), int64_t{6000000000});
+}
+
+TEST(TransportationProblemMethodTest, SharedWorkspaceMatchesFreshSolves)
+{
+    TransportationProblem::Workspace workspace;
+    for (size_t size : {12, 4, 9, 12})
+    {
+        std::vector<int> supply, demand;
+        generateSupplyAndDemand(size, size + 3, supply, demand);
+        auto costMatrix = generateRandomMatrix(size, size + 3);
+
+        TransportationProblem fresh(supply, demand, costMatrix);
+        fresh.balance();
+        fresh.solveHungarianMethod();
+
+        TransportationProblem reused({}, {}, {});
+        reused.reset(supply, demand, costMatrix);
+        reused.balance();
+        reused.solveHungarianMethod(workspace);
+
+        EXPECT_EQ(reused.getTotalCost(), fresh.getTotalCost());
+        EXPECT_EQ(reused.getAssignmentMatrix(), fresh.getAssignmentMatrix());
+    }
+    EXPECT_THROW(TransportationProblem({}, {}, {}).reset({1, 2}, {3}, {{1}}), std::invalid_argument);
+}
+
+TEST(TransportationProblemMethodTest, EveryInitialFlowReachesTheSameOptimum)
+{
+    for (size_t size : {3, 8, 20})
+    {
+        std::vector<int> supply, demand;
+        generateSupplyAndDemand(size, size + 5, supply, demand);
+        auto costMatrix = generateRandomMatrix(size, size + 5);
+
+        TransportationProblem sequential(supply, demand, costMatrix);
+        sequential.balance();
+        sequential.solveHungarianMethod();
+        EXPECT_EQ(sequential.getInitialFlow(), InitialFlow::Sequential);
+
+        for (InitialFlow method : {InitialFlow::Greedy, InitialFlow::Vogel, InitialFlow::Russell})
+        {
+            TransportationProblem problem(supply, demand, costMatrix);
+            problem.setInitialFlow(method);
+            problem.balance();
+            problem.solveHungarianMethod();
+            EXPECT_EQ(problem.getTotalCost(), sequential.getTotalCost());
+
+            const auto &assignment = problem.getAssignmentMatrix();
+            for (size_t j = 0; j < demand.size(); ++j)
+            {
+                int served = 0;
+                for (size_t i = 0; i < supply.size(); ++i)
+                    served += assignment[i][j];
+                EXPECT_EQ(served, demand[j]);
+            }
+        }
+    }
+
+    BasicTransportationProblem<double> fractional({4, 6}, {5, 5}, {{1.5, 2.25}, {0.5, 3.0}});
+    fractional.setInitialFlow(InitialFlow::Russell);
+    fractional.solveHungarianMethod();
+    EXPECT_DOUBLE_EQ(fractional.getTotalCost(), 4 * 2.25 + 5 * 0.5 + 1 * 3.0);
+}
+
+TEST(TransportationProblemMethodTest, DualBoundReachesTheOptimumAndStopsAtTheCutoff)
+{
+    for (size_t size : {4, 10, 25})
+    {
+        std::vector<int> supply, demand;
+        generateSupplyAndDemand(size, size + 2, supply, demand);
+        auto costMatrix = generateRandomMatrix(size, size + 2);
+
+        TransportationProblem problem(supply, demand, costMatrix);
+        problem.balance();
+        TransportationProblem::Workspace workspace;
+        ASSERT_TRUE(problem.solveHungarianMethod(workspace, std::numeric_limits<int64_t>::max()));
+        int64_t optimum = problem.getTotalCost();
+        EXPECT_EQ(problem.getLowerBound(), optimum);
+
+        EXPECT_TRUE(problem.solveHungarianMethod(workspace, optimum + 1));
+        EXPECT_EQ(problem.getTotalCost(), optimum);
+
+        // Un corte por debajo del óptimo se alcanza salvo que la reducción ya resuelva el problema
+        int64_t cutoff = optimum / 2;
+        if (problem.solveHungarianMethod(workspace, cutoff))
+        {
+            EXPECT_EQ(problem.getTotalCost(), optimum);
+        }
+        else
+        {
+            EXPECT_GE(problem.getLowerBound(), cutoff);
+            EXPECT_LE(problem.getLowerBound(), optimum);
+            EXPECT_EQ(problem.getTotalCost(), 0);
+        }
+    }
+}
+
+TEST(TransportationProblemMethodTest, WorkspaceReserveSkipsTheInitialFlowCells)
+{
+    if (!MemoryAccounting::kEnabled)
+    {
+        GTEST_SKIP() << "Built without CFLP_ALLOCATION_TRACKING";
+    }
+    const size_t agents = 100, jobs = 1000;
+    MemoryAccounting::ThreadMeter meter;
+    TransportationProblem::Workspace workspace;
+    workspace.reserve(agents, jobs);
+
+    // La matriz ocupa 16 bytes por celda; la lista de celdas del flujo inicial no se reserva
+    EXPECT_LT(meter.read().peakTotalBytes, static_cast<int64_t>(agents * jobs * 24));
+}
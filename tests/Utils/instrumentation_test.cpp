@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include "Utils/instrumentation.h"
+#include "TabuSearch/tabu_search_solver.h"
+#include "Reader/beasley_instance_reader.h"
+#include <sstream>
+#include <thread>
+
+namespace {
+
+std::string instancePath(const std::string &name) {
+    return std::string(CFLP_INSTANCES_DIR) + "/Beasley/" + name;
+}
+
+} // namespace
+
+TEST(InstrumentationTest, ReportsAddAndSubtractPerField) {
+    Instrumentation::Report a;
+    a.counters[static_cast<size_t>(Instrumentation::Counter::Toggles)] = 7;
+    a.nanoseconds[static_cast<size_t>(Instrumentation::Timer::MainSearch)] = 2000000000;
+    Instrumentation::Report b = a;
+    b += a;
+    EXPECT_EQ(b.get(Instrumentation::Counter::Toggles), 14u);
+    EXPECT_DOUBLE_EQ(b.seconds(Instrumentation::Timer::MainSearch), 4.0);
+
+    b -= a;
+    b -= a;
+    b -= a;
+    EXPECT_EQ(b.get(Instrumentation::Counter::Toggles), 0u);
+}
+
+TEST(InstrumentationTest, WritesEveryCounterAndTimerAsJson) {
+    Instrumentation::Report report;
+    report.counters[static_cast<size_t>(Instrumentation::Counter::PlqtProbes)] = 3;
+    std::ostringstream json;
+    report.writeJson(json);
+
+    EXPECT_NE(json.str().find("\"plqt_probes\": 3"), std::string::npos);
+    for (size_t c = 0; c < Instrumentation::kCounterCount; ++c) {
+        EXPECT_NE(json.str().find(Instrumentation::name(static_cast<Instrumentation::Counter>(c))),
+                  std::string::npos);
+    }
+    for (size_t t = 0; t < Instrumentation::kTimerCount; ++t) {
+        EXPECT_NE(json.str().find(Instrumentation::name(static_cast<Instrumentation::Timer>(t))),
+                  std::string::npos);
+    }
+}
+
+TEST(InstrumentationTest, CollectsCountersOfFinishedThreads) {
+    if (!Instrumentation::kEnabled) {
+        GTEST_SKIP() << "Built without CFLP_INSTRUMENTATION";
+    }
+    uint64_t before = Instrumentation::collect().get(Instrumentation::Counter::PlqtInserts);
+    std::thread worker([] {
+        for (int i = 0; i < 5; ++i) {
+            CFLP_COUNT(PlqtInserts);
+        }
+    });
+    worker.join();
+    EXPECT_EQ(Instrumentation::collect().get(Instrumentation::Counter::PlqtInserts), before + 5);
+}
+
+TEST(InstrumentationTest, SolveReportsHotPathCounters) {
+    CFLPProblem problem = BeasleyInstanceReader().readInstance(instancePath("cap41.txt"));
+    TabuSearchSolver solver(problem);
+    solver.solve();
+    const Instrumentation::Report &report = solver.getInstrumentation();
+
+    if (!Instrumentation::kEnabled) {
+        EXPECT_EQ(report.get(Instrumentation::Counter::Toggles), 0u);
+        return;
+    }
+    EXPECT_GT(report.get(Instrumentation::Counter::Toggles), 0u);
+    EXPECT_GE(report.get(Instrumentation::Counter::TransportSolves), 1u);
+    EXPECT_GE(report.get(Instrumentation::Counter::HungarianStep1),
+              report.get(Instrumentation::Counter::TransportSolves));
+    EXPECT_GE(report.get(Instrumentation::Counter::PlqtProbeDepth),
+              report.get(Instrumentation::Counter::PlqtProbes));
+    EXPECT_GT(report.seconds(Instrumentation::Timer::TransportSolve), 0.0);
+    EXPECT_GT(report.seconds(Instrumentation::Timer::MainSearch), 0.0);
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include "Utils/memory_accounting.h"
+#include "TabuSearch/tabu_search_solver.h"
+#include "Reader/beasley_instance_reader.h"
+#include <sstream>
+
+namespace {
+
+std::string instancePath(const std::string &name) {
+    return std::string(CFLP_INSTANCES_DIR) + "/Beasley/" + name;
+}
+
+// Mantiene vivas las asignaciones de las pruebas para que el compilador no las elimine
+std::vector<std::vector<int>> sink;
+
+} // namespace
+
+TEST(MemoryAccountingTest, WritesEverySubsystemAsJson) {
+    MemoryAccounting::Report report;
+    report.usage[static_cast<size_t>(MemoryAccounting::Subsystem::Plqt)].allocations = 4;
+    std::ostringstream json;
+    report.writeJson(json);
+
+    EXPECT_NE(json.str().find("\"plqt\": {\"allocations\": 4,"), std::string::npos);
+    for (size_t s = 0; s < MemoryAccounting::kSubsystemCount; ++s) {
+        EXPECT_NE(json.str().find(MemoryAccounting::name(static_cast<MemoryAccounting::Subsystem>(s))),
+                  std::string::npos);
+    }
+}
+
+TEST(MemoryAccountingTest, ChargesAllocationsToTheInnermostScope) {
+    if (!MemoryAccounting::kEnabled) {
+        GTEST_SKIP() << "Built without CFLP_ALLOCATION_TRACKING";
+    }
+    MemoryAccounting::ThreadMeter meter;
+    {
+        CFLP_ALLOCATION_SCOPE(Problem);
+        sink.emplace_back(1000);
+        {
+            CFLP_ALLOCATION_SCOPE(Plqt);
+            sink.reserve(sink.size() + 16);
+            sink.emplace_back(2000);
+        }
+    }
+    sink.clear();
+    sink.shrink_to_fit();
+
+    MemoryAccounting::Report report = meter.read();
+    const MemoryAccounting::Usage &plqt = report.get(MemoryAccounting::Subsystem::Plqt);
+    const MemoryAccounting::Usage &problem = report.get(MemoryAccounting::Subsystem::Problem);
+    EXPECT_GE(plqt.allocations, 2u);
+    EXPECT_GE(plqt.totalBytes, 2000 * sizeof(int));
+    EXPECT_EQ(plqt.currentBytes, 0);
+    EXPECT_GE(plqt.peakBytes, static_cast<int64_t>(2000 * sizeof(int)));
+    EXPECT_GE(problem.totalBytes, 1000 * sizeof(int));
+    EXPECT_EQ(problem.currentBytes, 0);
+    EXPECT_GE(report.peakTotalBytes, static_cast<int64_t>(3000 * sizeof(int)));
+    EXPECT_EQ(report.total().currentBytes, 0);
+}
+
+TEST(MemoryAccountingTest, SolveReportsUsagePerSubsystem) {
+    CFLPProblem problem = BeasleyInstanceReader().readInstance(instancePath("cap41.txt"));
+    TabuSearchSolver solver(problem);
+    solver.solve();
+    const MemoryAccounting::Report &report = solver.getMemoryUsage();
+
+    if (!MemoryAccounting::kEnabled) {
+        EXPECT_EQ(report.total().allocations, 0u);
+        return;
+    }
+    EXPECT_GT(report.get(MemoryAccounting::Subsystem::Transport).allocations, 0u);
+    EXPECT_GT(report.get(MemoryAccounting::Subsystem::Plqt).allocations, 0u);
+    EXPECT_GT(report.get(MemoryAccounting::Subsystem::Solver).allocations, 0u);
+    EXPECT_GT(report.peakTotalBytes, 0);
+    EXPECT_GE(report.total().totalBytes, static_cast<uint64_t>(report.peakTotalBytes));
+}
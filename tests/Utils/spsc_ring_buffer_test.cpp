@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include "Utils/spsc_ring_buffer.h"
+#include <thread>
+
+TEST(SpscRingBufferTest, RoundsCapacityToPowerOfTwo) {
+    SpscRingBuffer<int> buffer(5);
+    EXPECT_EQ(buffer.capacity(), 8u);
+    EXPECT_THROW(SpscRingBuffer<int>(0), std::invalid_argument);
+}
+
+TEST(SpscRingBufferTest, PopsInOrderAndRejectsPushWhenFull) {
+    SpscRingBuffer<int> buffer(4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(buffer.push(i));
+    }
+    EXPECT_FALSE(buffer.push(4));
+    EXPECT_EQ(buffer.size(), 4u);
+
+    int value = -1;
+    ASSERT_TRUE(buffer.pop(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(buffer.push(4));
+
+    std::vector<int> drained;
+    EXPECT_EQ(buffer.drain([&drained](int v) { drained.push_back(v); }), 4u);
+    EXPECT_EQ(drained, (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_FALSE(buffer.pop(value));
+}
+
+TEST(SpscRingBufferTest, TransfersEveryValueAcrossThreads) {
+    const int count = 200000;
+    SpscRingBuffer<int> buffer(64);
+
+    std::thread producer([&buffer] {
+        for (int i = 0; i < count; ++i) {
+            while (!buffer.push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    bool ordered = true;
+    while (expected < count) {
+        buffer.drain([&](int v) {
+            ordered = ordered && v == expected;
+            ++expected;
+        });
+    }
+    producer.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(buffer.size(), 0u);
+}
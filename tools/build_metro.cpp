@@ -0,0 +1,72 @@
+#include "InstanceBuilder/metro_instance_builder.h"
+#include "Reader/binary_instance.h"
+
+#include <iostream>
+#include <string>
+
+/**
+ * Builds a CFLP instance from a metro network database and saves it in binary form.
+ *
+ * Usage: cflp_metro <database> <output.cflpb> [options]
+ *   --distance m|hops    length of each connection: track metres or hops (default: m)
+ *   --facilities N       candidate service points at the busiest stations (0 for all)
+ *   --demand-unit F      annual flow per demand unit
+ *   --capacity-factor F  total capacity over total demand
+ *   --opening-cost C     opening cost of every service point
+ *   --cost-per-unit K    unit transportation cost per metre or hop
+ *   --threads T          threads running shortest paths (0 for all cores)
+ */
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <database> <output.cflpb> [options]" << std::endl;
+        return 2;
+    }
+
+    MetroOptions options;
+    try
+    {
+        for (int arg = 3; arg < argc; arg += 2)
+        {
+            std::string flag = argv[arg];
+            if (arg + 1 >= argc)
+            {
+                throw std::invalid_argument("Missing value for " + flag);
+            }
+            std::string value = argv[arg + 1];
+
+            if (flag == "--distance")
+            {
+                if (value != "m" && value != "hops")
+                    throw std::invalid_argument("Unknown distance " + value);
+                options.distance = value == "m" ? MetroDistance::Metres : MetroDistance::Hops;
+            }
+            else if (flag == "--facilities")
+                options.facilities = std::stoul(value);
+            else if (flag == "--demand-unit")
+                options.flowPerDemandUnit = std::stod(value);
+            else if (flag == "--capacity-factor")
+                options.capacityFactor = std::stod(value);
+            else if (flag == "--opening-cost")
+                options.openingCost = std::stod(value);
+            else if (flag == "--cost-per-unit")
+                options.costPerUnit = std::stod(value);
+            else if (flag == "--threads")
+                options.threads = static_cast<unsigned>(std::stoul(value));
+            else
+                throw std::invalid_argument("Unknown option " + flag);
+        }
+
+        CFLPProblem problem = MetroInstanceBuilder(argv[1]).build(options);
+        BinaryInstance::write(problem, argv[2]);
+        std::cout << argv[2] << ": " << problem.getCapacities().size() << " service points, "
+                  << problem.getDemands().size() << " stations" << std::endl;
+    }
+    catch (const std::exception &error)
+    {
+        std::cerr << error.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
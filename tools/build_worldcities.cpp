@@ -0,0 +1,82 @@
+#include "InstanceBuilder/world_cities_builder.h"
+#include "Reader/binary_instance.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+/**
+ * Builds a CFLP instance from the worldcities table and saves it in binary form.
+ *
+ * Usage: cflp_worldcities <database> <output.cflpb> [options]
+ *   --customers N        customer cities, most populated first (0 for all)
+ *   --facilities N       candidate facilities at the most populated customers
+ *   --countries A,B      countries to include (default: all)
+ *   --min-population N   smallest population of a customer city
+ *   --demand-unit P      population per demand unit
+ *   --capacity-factor F  total capacity over total demand
+ *   --opening-cost C     opening cost of every facility
+ *   --cost-per-km K      unit transportation cost per kilometre
+ *   --threads T          threads computing the cost matrix (0 for all cores)
+ */
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <database> <output.cflpb> [options]" << std::endl;
+        return 2;
+    }
+
+    WorldCitiesOptions options;
+    try
+    {
+        for (int arg = 3; arg < argc; arg += 2)
+        {
+            std::string flag = argv[arg];
+            if (arg + 1 >= argc)
+            {
+                throw std::invalid_argument("Missing value for " + flag);
+            }
+            std::string value = argv[arg + 1];
+
+            if (flag == "--customers")
+                options.customers = std::stoul(value);
+            else if (flag == "--facilities")
+                options.facilities = std::stoul(value);
+            else if (flag == "--min-population")
+                options.minPopulation = std::stoll(value);
+            else if (flag == "--demand-unit")
+                options.populationPerDemandUnit = std::stod(value);
+            else if (flag == "--capacity-factor")
+                options.capacityFactor = std::stod(value);
+            else if (flag == "--opening-cost")
+                options.openingCost = std::stod(value);
+            else if (flag == "--cost-per-km")
+                options.costPerKm = std::stod(value);
+            else if (flag == "--threads")
+                options.threads = static_cast<unsigned>(std::stoul(value));
+            else if (flag == "--countries")
+            {
+                std::istringstream list(value);
+                std::string country;
+                while (std::getline(list, country, ','))
+                {
+                    options.countries.push_back(country);
+                }
+            }
+            else
+                throw std::invalid_argument("Unknown option " + flag);
+        }
+
+        CFLPProblem problem = WorldCitiesInstanceBuilder(argv[1]).build(options);
+        BinaryInstance::write(problem, argv[2]);
+        std::cout << argv[2] << ": " << problem.getCapacities().size() << " facilities, "
+                  << problem.getDemands().size() << " customers" << std::endl;
+    }
+    catch (const std::exception &error)
+    {
+        std::cerr << error.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
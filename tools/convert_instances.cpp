@@ -0,0 +1,72 @@
+#include "Reader/auto_instance_reader.h"
+#include "Reader/binary_instance.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+
+/**
+ * Converts text instances to the binary format read by BinaryInstanceReader.
+ *
+ * Usage: cflp_convert <output-dir> <instance.txt | directory>...
+ *
+ * Directories are expanded to the .txt files they contain. Each instance is
+ * written as <output-dir>/<stem>.cflpb. The text format (Beasley, Holmberg,
+ * Yang or TBED) is detected from the content of each file. Files that fail
+ * to parse are reported and skipped; the exit status is non-zero if any
+ * file failed.
+ */
+int main(int argc, char *argv[])
+{
+    namespace fs = std::filesystem;
+
+    if (argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <output-dir> <instance.txt | directory>..." << std::endl;
+        return 2;
+    }
+
+    fs::path outputDir = argv[1];
+    fs::create_directories(outputDir);
+
+    std::vector<fs::path> inputs;
+    for (int arg = 2; arg < argc; ++arg)
+    {
+        fs::path input = argv[arg];
+        if (fs::is_directory(input))
+        {
+            for (const auto &entry : fs::directory_iterator(input))
+            {
+                if (entry.is_regular_file() && entry.path().extension() == ".txt")
+                {
+                    inputs.push_back(entry.path());
+                }
+            }
+        }
+        else
+        {
+            inputs.push_back(input);
+        }
+    }
+    std::sort(inputs.begin(), inputs.end());
+
+    AutoInstanceReader reader;
+    int failures = 0;
+    for (const fs::path &input : inputs)
+    {
+        fs::path output = outputDir / input.stem();
+        output += BinaryInstance::kExtension;
+        try
+        {
+            BinaryInstance::write(reader.readInstanceAs<double>(input.string()), output.string());
+            std::cout << input.string() << " -> " << output.string() << std::endl;
+        }
+        catch (const std::exception &error)
+        {
+            std::cerr << error.what() << std::endl;
+            ++failures;
+        }
+    }
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,74 @@
+#include "InstanceBuilder/random_instance_generator.h"
+#include "Reader/binary_instance.h"
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+/**
+ * Generates a random CFLP instance (see RandomInstanceGenerator).
+ *
+ * Usage: cflp_generate <output> [options]
+ *   --facilities M       number of facilities (default 100)
+ *   --customers N        number of customers (default 1000)
+ *   --ratio R            total capacity over total demand (default 3)
+ *   --seed S             seed of the instance (default 1)
+ *   --threads T          threads generating blocks (0 for all cores)
+ *
+ * The output is written in binary form if its extension is .cflpb and in
+ * the Beasley text format otherwise.
+ */
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <output> [options]" << std::endl;
+        return 2;
+    }
+
+    RandomInstanceOptions options;
+    try
+    {
+        for (int arg = 2; arg < argc; arg += 2)
+        {
+            std::string flag = argv[arg];
+            if (arg + 1 >= argc)
+            {
+                throw std::invalid_argument("Missing value for " + flag);
+            }
+            std::string value = argv[arg + 1];
+
+            if (flag == "--facilities")
+                options.facilities = std::stoul(value);
+            else if (flag == "--customers")
+                options.customers = std::stoul(value);
+            else if (flag == "--ratio")
+                options.capacityRatio = std::stod(value);
+            else if (flag == "--seed")
+                options.seed = std::stoull(value);
+            else if (flag == "--threads")
+                options.threads = static_cast<unsigned>(std::stoul(value));
+            else
+                throw std::invalid_argument("Unknown option " + flag);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::string output = argv[1];
+        RandomInstanceGenerator generator(options);
+        if (std::filesystem::path(output).extension() == BinaryInstance::kExtension)
+            generator.writeBinary(output);
+        else
+            generator.writeText(output);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << output << ": " << options.facilities << " facilities, " << options.customers
+                  << " customers, seed " << options.seed << " (" << elapsed.count() << " s)" << std::endl;
+    }
+    catch (const std::exception &error)
+    {
+        std::cerr << error.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}